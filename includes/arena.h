@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_H
+# define ARENA_H
+
+# include <stdlib.h>
+
+# define ARENA_BLOCK_SIZE 4096
+# define ARENA_ALIGN 8
+
+/*
+** Bump allocator for everything built from one command line: tokens,
+** their strings, AST nodes, redirections and argv arrays. Nothing is
+** freed individually; arena_reset drops it all at once and keeps the
+** largest block for the next line.
+*/
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;
+	size_t					size;
+	size_t					used;
+}	t_arena_block;
+
+typedef struct s_arena
+{
+	t_arena_block	*head;
+}	t_arena;
+
+void	arena_init(t_arena *arena);
+void	*arena_alloc(t_arena *arena, size_t size);
+char	*arena_strndup(t_arena *arena, const char *s, size_t n);
+void	arena_reset(t_arena *arena);
+void	arena_free(t_arena *arena);
+
+#endif
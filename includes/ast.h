@@ -15,6 +15,7 @@
 
 # include <stdlib.h>
 # include "tokens.h"
+# include "arena.h"
 
 typedef enum e_node_type
 {
@@ -38,6 +39,8 @@ typedef struct s_redirect
 	t_redir_type		type;
 	char				*file;
 	int					heredoc_fd;
+	int					quoted;
+	int					expand;
 	struct s_redirect	*next;
 }	t_redirect;
 
@@ -53,6 +56,13 @@ typedef struct s_binop_node
 	struct s_ast_node	*right;
 }	t_binop_node;
 
+typedef struct s_pipeline_node
+{
+	struct s_ast_node	**stages;
+	int					count;
+	int					capacity;
+}	t_pipeline_node;
+
 typedef struct s_subshell_node
 {
 	struct s_ast_node	*child;
@@ -63,6 +73,7 @@ typedef union u_node_data
 {
 	t_cmd_node			cmd;
 	t_binop_node		binop;
+	t_pipeline_node		pipeline;
 	t_subshell_node		subshell;
 }	t_node_data;
 
@@ -72,12 +83,15 @@ typedef struct s_ast_node
 	t_node_data	data;
 }	t_ast_node;
 
-t_ast_node		*create_cmd_node(char **argv, t_redirect *redir);
-t_ast_node		*create_binop_node(t_node_type type,
+t_ast_node		*create_cmd_node(t_arena *arena, char **argv,
+					t_redirect *redir);
+t_ast_node		*create_binop_node(t_arena *arena, t_node_type type,
 					t_ast_node *left, t_ast_node *right);
-t_ast_node		*create_subshell_node(t_ast_node *child, t_redirect *redir);
-void			free_ast(t_ast_node *node);
-void			free_redirect_list(t_redirect *redir);
+t_ast_node		*create_subshell_node(t_arena *arena, t_ast_node *child,
+					t_redirect *redir);
+t_ast_node		*create_pipeline_node(t_arena *arena, t_ast_node *first);
+int				pipeline_add_stage(t_arena *arena, t_ast_node *node,
+					t_ast_node *stage);
 void			free_argv(char **argv);
 
 #endif
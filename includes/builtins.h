@@ -25,5 +25,6 @@ int		builtin_env(char **argv, struct s_exec_ctx *ctx);
 int		builtin_export(char **argv, struct s_exec_ctx *ctx);
 int		builtin_unset(char **argv, struct s_exec_ctx *ctx);
 int		builtin_exit(char **argv, struct s_exec_ctx *ctx);
+int		builtin_hash(char **argv, struct s_exec_ctx *ctx);
 
 #endif
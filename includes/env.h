@@ -15,21 +15,40 @@
 
 # include <stdlib.h>
 
+# define ENV_INIT_CAPACITY 64
+
+typedef struct s_env_var
+{
+	char				*key;
+	char				*value;
+	unsigned int		hash;
+	struct s_env_var	*prev;
+	struct s_env_var	*next;
+}	t_env_var;
+
 typedef struct s_env
 {
-	char			*key;
-	char			*value;
-	struct s_env	*next;
+	t_env_var		**slots;
+	unsigned int	capacity;
+	int				count;
+	t_env_var		*head;
+	t_env_var		*tail;
+	int				dirty;
 }	t_env;
 
-t_env	*init_env(char **environ);
-char	*env_get(t_env *env, char *key);
-int		env_set(t_env **env, char *key, char *value);
-int		env_unset(t_env **env, char *key);
-void	free_env(t_env *env);
-t_env	*env_node_new(char *key, char *value);
-t_env	*env_find(t_env *env, char *key);
-int		env_count(t_env *env);
-char	*env_to_string(t_env *node);
+t_env			*init_env(char **environ);
+char			*env_get(t_env *env, char *key);
+char			*env_get_n(t_env *env, char *name, size_t len);
+int				env_set(t_env **env, char *key, char *value);
+int				env_unset(t_env **env, char *key);
+void			free_env(t_env *env);
+t_env_var		*env_node_new(char *key, char *value);
+t_env_var		*env_find(t_env *env, char *key);
+int				env_count(t_env *env);
+char			*env_to_string(t_env_var *node);
+t_env			*env_table_new(unsigned int capacity);
+unsigned int	env_hash(char *key);
+unsigned int	env_slot_of(t_env *env, char *key, unsigned int hash);
+int				env_table_insert(t_env *env, t_env_var *var);
 
 #endif
@@ -15,31 +15,99 @@
 
 # include "ast.h"
 # include "env.h"
+# include "strbuf.h"
+# include "reader.h"
+# include "timing.h"
+# include "trace.h"
+
+# define CMD_HASH_SIZE 64
+
+/* Heredoc spool files where memfd_create is missing (heredoc_spool.c) */
+# define HEREDOC_TMPDIR "/tmp"
+# define HEREDOC_TEMPLATE "/tmp/minishell-heredoc-XXXXXX"
+# define HEREDOC_FLUSH_SIZE 65536
+
+typedef struct s_hash_entry
+{
+	char				*name;
+	char				*path;
+	int					hits;
+	struct s_hash_entry	*next;
+}	t_hash_entry;
 
 typedef struct s_exec_ctx
 {
-	t_env	*env;
-	int		last_status;
-	int		stdin_backup;
-	int		stdout_backup;
+	t_env			*env;
+	int				last_status;
+	int				stdin_backup;
+	int				stdout_backup;
+	t_hash_entry	*cmd_hash[CMD_HASH_SIZE];
+	char			**envp;
+	int				spawn_enabled;
+	t_strbuf		expand_buf;
+	t_reader		*reader;
+	int				interactive;
+	int				exec_tail;
+	t_arena			line_arena;
+	t_timing		timing;
+	t_trace			trace;
 }	t_exec_ctx;
 
-int			execute_ast(t_ast_node *ast, t_exec_ctx *ctx);
-int			exec_command(t_cmd_node *cmd, t_exec_ctx *ctx);
-int			exec_pipe(t_binop_node *pipe, t_exec_ctx *ctx);
-int			exec_and(t_binop_node *and_node, t_exec_ctx *ctx);
-int			exec_or(t_binop_node *or_node, t_exec_ctx *ctx);
-int			exec_subshell(t_subshell_node *subshell, t_exec_ctx *ctx);
-char		*resolve_path(char *command, t_env *env);
-char		**env_to_envp(t_env *env);
-void		free_envp(char **envp);
-t_exec_ctx	*init_exec_ctx(char **environ);
-void		cleanup_exec_ctx(t_exec_ctx *ctx);
-int			exec_external(char **argv, t_env *env);
-int			wait_child(int pid);
-int			setup_redirects(t_redirect *redir, t_exec_ctx *ctx);
-void		restore_redirects(t_exec_ctx *ctx);
-int			process_heredoc(t_redirect *redir, t_exec_ctx *ctx);
-int			process_all_heredocs(t_redirect *redir, t_exec_ctx *ctx);
+/*
+** A heredoc body on its way into a spool file (fd): lines are batched in
+** out and written every HEREDOC_FLUSH_SIZE bytes. line and cap are the
+** getline buffer when the body comes from stdin.
+*/
+typedef struct s_heredoc_io
+{
+	int			fd;
+	t_strbuf	out;
+	char		*line;
+	size_t		cap;
+	int			prompt;
+}	t_heredoc_io;
+
+typedef int		(*t_redir_fn)(t_redirect *redir, t_exec_ctx *ctx);
+
+int				execute_ast(t_ast_node *ast, t_exec_ctx *ctx);
+int				exec_command(t_cmd_node *cmd, t_exec_ctx *ctx);
+int				exec_pipe(t_pipeline_node *pipeline, t_exec_ctx *ctx);
+int				exec_and(t_binop_node *and_node, t_exec_ctx *ctx);
+int				exec_or(t_binop_node *or_node, t_exec_ctx *ctx);
+int				exec_subshell(t_subshell_node *subshell, t_exec_ctx *ctx);
+char			*resolve_path(char *command, t_env *env);
+char			*resolve_cached(char *command, t_exec_ctx *ctx);
+t_hash_entry	*cmd_hash_find(t_exec_ctx *ctx, char *name);
+t_hash_entry	*cmd_hash_add(t_exec_ctx *ctx, char *name, char *path);
+void			cmd_hash_clear(t_exec_ctx *ctx);
+void			cmd_hash_env_changed(t_exec_ctx *ctx, char *key);
+char			**env_to_envp(t_env *env);
+void			free_envp(char **envp);
+char			**exec_envp(t_exec_ctx *ctx);
+void			exec_env_changed(t_exec_ctx *ctx, char *key);
+t_exec_ctx		*init_exec_ctx(char **environ);
+void			cleanup_exec_ctx(t_exec_ctx *ctx);
+int				exec_external(char **argv, char *path, char **envp);
+int				run_external(t_cmd_node *cmd, t_exec_ctx *ctx);
+int				exec_spawned(t_cmd_node *cmd, char *path, t_exec_ctx *ctx,
+					int *status);
+int				wait_child(int pid, t_exec_ctx *ctx);
+long long		exec_clock(t_exec_ctx *ctx);
+void			exec_spawn_done(t_exec_ctx *ctx, int pid, const char *name,
+					long long start);
+const char		*exec_node_name(t_ast_node *node);
+int				apply_redirects(t_redirect *redir, t_exec_ctx *ctx);
+int				setup_redirects(t_redirect *redir, t_exec_ctx *ctx);
+void			restore_redirects(t_exec_ctx *ctx);
+void			close_heredoc_fds(t_redirect *redir);
+int				heredoc_spool(void);
+int				heredoc_flush(t_heredoc_io *io, size_t min);
+int				process_heredoc(t_redirect *redir, t_exec_ctx *ctx);
+int				process_all_heredocs(t_redirect *redir, t_exec_ctx *ctx);
+int				heredoc_append(t_heredoc_io *io, char *line, int expand,
+					t_exec_ctx *ctx);
+int				expand_heredocs(t_redirect *redir, t_exec_ctx *ctx);
+int				collect_heredocs(t_ast_node *ast, t_exec_ctx *ctx);
+void			close_all_heredocs(t_ast_node *ast, t_exec_ctx *ctx);
 
 #endif
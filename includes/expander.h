@@ -14,19 +14,62 @@
 # define EXPANDER_H
 
 # include "executor.h"
+# include "strvec.h"
+
+# define GLOB_SORT_CUTOFF 12
+
+/*
+** Quote removal puts this byte before every * ? [ ] that was quoted, so
+** that wildcard expansion takes it literally; glob_unmark drops it from
+** words that are used as they are.
+*/
+# define GLOB_QUOTED '\001'
+
+typedef struct s_dirlist
+{
+	t_strbuf	names;
+	t_strvec	entries;
+	int			loaded;
+}	t_dirlist;
+
+typedef enum e_glob_kind
+{
+	GLOB_LITERAL,
+	GLOB_ANY,
+	GLOB_CLASS,
+	GLOB_STAR
+}	t_glob_kind;
+
+typedef struct s_glob_elem
+{
+	t_glob_kind		kind;
+	unsigned char	ch;
+	unsigned char	set[32];
+}	t_glob_elem;
+
+typedef struct s_glob
+{
+	t_glob_elem	*elems;
+	int			count;
+}	t_glob;
 
 char	*expand_variables(char *str, t_exec_ctx *ctx);
-char	*remove_quotes(char *str, t_exec_ctx *ctx);
-void	expand_tokens(t_token *tokens, t_exec_ctx *ctx);
-char	*append_str(char *result, char *add);
-char	*append_char(char *result, char c);
-char	*append_result(char *result, char *add);
-char	*extract_substring(char *str, int start, int end);
-char	*get_unquoted_segment(char *str, int *i);
-char	**expand_wildcard(char *pattern);
+char	*remove_quotes(char *str, size_t len, t_exec_ctx *ctx);
+char	*strip_quotes(char *str, size_t len, t_exec_ctx *ctx);
+void	expand_tokens(t_token *tokens, t_exec_ctx *ctx, t_arena *arena);
+void	expand_into(t_strbuf *sb, char *str, size_t len, t_exec_ctx *ctx);
+void	append_status(t_strbuf *sb, int status);
+size_t	var_name_len(char *str, size_t max);
+int		needs_expansion(char *str, size_t len);
+void	glob_mark_quoted(t_strbuf *sb, size_t from);
+char	*glob_unmark(char *word);
 char	**expand_argv_wildcards(char **argv);
-int		count_expanded_args(char **argv);
-void	copy_matches(char **result, char **matches, int *idx);
-void	sort_matches(char **matches, int count);
+int		dirlist_load(t_dirlist *dir);
+int		expand_glob_word(t_dirlist *dir, char *pattern, t_strvec *out);
+int		sort_matches(char **matches, int count);
+int		glob_compile(t_glob *g, char *pattern);
+void	glob_free(t_glob *g);
+int		glob_match(t_glob *g, char *str);
+int		is_glob_pattern(char *word);
 
 #endif
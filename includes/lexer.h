@@ -14,45 +14,65 @@
 # define LEXER_H
 
 # include "tokens.h"
+# include "arena.h"
 
-typedef enum e_lexer_state
+/*
+** Width of the span scanners in scan_*.c, fixed at build time. Build
+** with -D LEXER_SIMD=0 (make SIMD=none) to force the scalar loops.
+*/
+# ifndef LEXER_SIMD
+#  define LEXER_SIMD 1
+# endif
+# if LEXER_SIMD && defined(__AVX2__)
+#  define LEXER_SCAN_WIDTH 32
+# elif LEXER_SIMD && defined(__SSE2__)
+#  define LEXER_SCAN_WIDTH 16
+# else
+#  define LEXER_SCAN_WIDTH 1
+# endif
+
+/*
+** Byte classes for lexer_classes(). Anything not listed in the table is
+** CC_WORD, so runs of plain word characters are consumed in one loop.
+*/
+typedef enum e_char_class
 {
-	STATE_INITIAL,
-	STATE_WORD,
-	STATE_SQUOTE,
-	STATE_DQUOTE,
-	STATE_OPERATOR
-}	t_lexer_state;
+	CC_WORD,
+	CC_BLANK,
+	CC_SQUOTE,
+	CC_DQUOTE,
+	CC_OPERATOR,
+	CC_END
+}	t_char_class;
 
 typedef struct s_lexer
 {
-	char			*input;
-	int				pos;
-	int				start;
-	t_lexer_state	state;
-	t_token			*tokens;
-	t_token			*current;
+	char				*input;
+	int					pos;
+	int					start;
+	const unsigned char	*classes;
+	t_token				*tokens;
+	t_token				*current;
+	t_arena				*arena;
 }	t_lexer;
 
-t_token			*tokenize(char *input);
-void			lexer_init(t_lexer *lex, char *input);
+t_token			*tokenize(char *input, t_arena *arena);
+void			lexer_init(t_lexer *lex, char *input, t_arena *arena);
 void			lexer_process(t_lexer *lex);
-void			lexer_free(t_lexer *lex);
-void			handle_initial_state(t_lexer *lex);
-void			handle_word_state(t_lexer *lex);
-void			handle_squote_state(t_lexer *lex);
-void			handle_dquote_state(t_lexer *lex);
-void			handle_operator_state(t_lexer *lex);
+void			lex_operator(t_lexer *lex);
+const unsigned char	*lexer_classes(void);
+int				lex_span_word(const char *input, int pos);
+int				lex_span_quote(const char *input, int pos, char quote);
 int				is_whitespace(char c);
 int				is_operator_char(char c);
 int				is_quote(char c);
 int				is_special_char(char c);
 t_token_type	try_two_char_operator(char *input, int pos);
 t_token_type	try_one_char_operator(char c);
-t_token			*token_create(t_token_type type, char *value, int pos);
+t_token			*token_create(t_lexer *lex, t_token_type type, int start,
+					int len);
 void			token_append(t_lexer *lex, t_token *token);
-void			token_list_free(t_token *tokens);
-char			*buffer_extract(t_lexer *lex, int start, int end);
+char			*token_value(t_token *token, t_arena *arena);
 void			buffer_add_word_token(t_lexer *lex);
 
 #endif
@@ -17,6 +17,7 @@
 # include "lexer.h"
 # include "ast.h"
 # include "parser.h"
+# include "executor.h"
 # include <stdlib.h>
 # include <unistd.h>
 
@@ -25,5 +26,6 @@
 
 void	error_exit(char *msg, int code);
 void	error_print(char *msg);
+void	process_line(char *line, t_exec_ctx *ctx);
 
 #endif
@@ -21,10 +21,12 @@ typedef struct s_parse_ctx
 	t_token	*curr;
 	t_token	*tokens;
 	int		error;
+	t_arena	*arena;
 }	t_parse_ctx;
 
-t_ast_node		*parse_tokens(t_token *tokens);
-t_parse_ctx		*init_parse_ctx(t_token *tokens);
+t_ast_node		*parse_tokens(t_token *tokens, t_arena *arena);
+void			init_parse_ctx(t_parse_ctx *ctx, t_token *tokens,
+					t_arena *arena);
 t_ast_node		*parse_or(t_parse_ctx *ctx);
 t_ast_node		*parse_and(t_parse_ctx *ctx);
 t_ast_node		*parse_pipe(t_parse_ctx *ctx);
@@ -32,7 +34,8 @@ t_ast_node		*parse_primary(t_parse_ctx *ctx);
 t_ast_node		*parse_command(t_parse_ctx *ctx);
 t_redirect		*parse_redirections(t_parse_ctx *ctx);
 t_redirect		*parse_single_redir(t_parse_ctx *ctx);
-t_redirect		*create_redirect(t_token_type type, char *file);
+t_redirect		*create_redirect(t_arena *arena, t_token_type type,
+					char *file);
 void			append_redirect(t_redirect **head, t_redirect *new);
 int				is_redir_token(t_token_type type);
 int				is_operator_token(t_token_type type);
@@ -48,14 +51,14 @@ void			syntax_error(char *token);
 void			unexpected_eof_error(void);
 void			unmatched_paren_error(void);
 int				is_at_end(t_parse_ctx *ctx);
-t_ast_node		*make_binop(t_node_type type, t_ast_node *l, t_ast_node *r);
-void			cleanup_parse(t_parse_ctx *ctx, t_ast_node *node);
+t_ast_node		*make_binop(t_parse_ctx *ctx, t_node_type type,
+					t_ast_node *l, t_ast_node *r);
 int				is_command_start(t_parse_ctx *ctx);
 int				has_command_word(t_parse_ctx *ctx);
 t_redir_type	token_to_redir(t_token_type type);
 char			**build_argv(t_parse_ctx *ctx, int *count);
 int				count_words(t_parse_ctx *ctx);
-char			**alloc_argv_array(int count);
+char			**alloc_argv_array(t_arena *arena, int count);
 void			fill_argv_array(t_parse_ctx *ctx, char **argv, int count);
 
 #endif
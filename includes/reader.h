@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reader.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef READER_H
+# define READER_H
+
+# include "strbuf.h"
+
+# define READER_BUF_SIZE 65536
+
+/*
+** Block-buffered line reader for scripts and piped input. Lines that
+** fit in the buffer are returned in place; only lines straddling a
+** refill are assembled in `line`. The returned pointer stays valid
+** until the next call.
+**
+** A shared reader (stdin, which the commands being run may also read)
+** never leaves input consumed past the current line: `rewind` seeks the
+** unused part of a block back, and `chunk` drops to one byte when the
+** fd cannot seek.
+*/
+typedef struct s_reader
+{
+	int			fd;
+	char		*buf;
+	size_t		pos;
+	size_t		end;
+	size_t		chunk;
+	int			rewind;
+	t_strbuf	line;
+}	t_reader;
+
+int		reader_open(t_reader *r, int fd);
+void	reader_share(t_reader *r);
+char	*reader_next_line(t_reader *r);
+void	reader_close(t_reader *r);
+
+#endif
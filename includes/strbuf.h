@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STRBUF_H
+# define STRBUF_H
+
+# include <stdlib.h>
+
+# define STRBUF_MIN_CAP 64
+
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_strbuf;
+
+void	sb_init(t_strbuf *sb);
+int		sb_reserve(t_strbuf *sb, size_t extra);
+int		sb_append_n(t_strbuf *sb, const char *s, size_t n);
+int		sb_append_char(t_strbuf *sb, char c);
+int		sb_append_str(t_strbuf *sb, const char *s);
+void	sb_reset(t_strbuf *sb);
+char	*sb_dup(t_strbuf *sb);
+void	sb_free(t_strbuf *sb);
+
+#endif
@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strvec.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STRVEC_H
+# define STRVEC_H
+
+# include <stdlib.h>
+
+# define STRVEC_MIN_CAP 16
+
+typedef struct s_strvec
+{
+	char	**items;
+	size_t	len;
+	size_t	cap;
+}	t_strvec;
+
+void	sv_init(t_strvec *sv);
+int		sv_push(t_strvec *sv, char *str);
+int		sv_push_dup(t_strvec *sv, char *str);
+void	sv_free(t_strvec *sv, int free_items);
+
+#endif
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TIMING_H
+# define TIMING_H
+
+/*
+** Per-line phase timings, enabled by MINISHELL_TIMING: "1" or "stderr"
+** reports to stderr, any other non-empty value except "0" names a file
+** to append to. Each command line then produces one report line:
+**
+**   timing line=<n> tokenize_ns=.. validate_ns=.. expand_ns=.. parse_ns=..
+**   exec_ns=.. heredoc_ns=.. spawn_ns=.. wait_ns=.. total_ns=.. spawns=<n>
+**
+** heredoc, spawn (fork or posix_spawn in the parent) and wait are parts
+** of exec. When disabled, no clock is read.
+*/
+typedef enum e_phase
+{
+	PHASE_TOKENIZE,
+	PHASE_VALIDATE,
+	PHASE_EXPAND,
+	PHASE_PARSE,
+	PHASE_EXEC,
+	PHASE_HEREDOC,
+	PHASE_SPAWN,
+	PHASE_WAIT,
+	PHASE_COUNT
+}	t_phase;
+
+typedef struct s_timing
+{
+	int			fd;
+	long		line;
+	long long	begin;
+	long long	last;
+	long long	ns[PHASE_COUNT];
+	int			spawns;
+}	t_timing;
+
+long long	timing_now(void);
+void		timing_begin(t_timing *timing);
+void		timing_lap(t_timing *timing, t_phase phase);
+long long	timing_start(t_timing *timing);
+void		timing_add(t_timing *timing, t_phase phase, long long start);
+void		timing_init(t_timing *timing, char *setting);
+void		timing_end(t_timing *timing);
+void		timing_close(t_timing *timing);
+
+#endif
@@ -30,14 +30,19 @@ typedef enum e_token_type
 	TOKEN_EOF
 }	t_token_type;
 
+/*
+** A token is a slice (start, len) of the input line. value stays NULL
+** until something needs a NUL-terminated string (token_value, or
+** expand_tokens for words).
+*/
 typedef struct s_token
 {
 	t_token_type	type;
 	char			*value;
+	char			*start;
+	int				len;
 	int				pos;
 	struct s_token	*next;
 }	t_token;
 
-void	free_tokens(t_token *tokens);
-
 #endif
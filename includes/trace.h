@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TRACE_H
+# define TRACE_H
+
+/*
+** Executor trace, enabled by MINISHELL_TRACE=<file>. The file is
+** truncated and filled with Chrome trace-event JSON, for chrome://tracing
+** or ui.perfetto.dev. Each child process is one complete event, from just
+** before its fork or posix_spawn until wait_child reaps it, on a row of
+** its own (tid = child pid). Pipelines, heredocs and redirect setup are
+** events on the shell's own row. Forked shells (pipeline stages,
+** subshells) append to the same file under their own pid.
+**
+** The closing ']' is written when the shell cleans up; the format allows
+** it to be missing, e.g. after the exit builtin.
+*/
+# define TRACE_MAX_CHILDREN 256
+# define TRACE_NAME_MAX 128
+# define TRACE_EVENT_MAX 512
+
+typedef struct s_trace_child
+{
+	int			pid;
+	long long	start;
+	const char	*name;
+}	t_trace_child;
+
+typedef struct s_trace
+{
+	int				fd;
+	int				owner;
+	int				count;
+	t_trace_child	children[TRACE_MAX_CHILDREN];
+}	t_trace;
+
+void	trace_init(t_trace *trace, char *path);
+void	trace_close(t_trace *trace);
+void	trace_write(t_trace *trace, t_trace_child *event, int status);
+void	trace_event(t_trace *trace, const char *name, long long start,
+			int status);
+void	trace_spawned(t_trace *trace, int pid, const char *name,
+			long long start);
+void	trace_reaped(t_trace *trace, int pid, int status);
+
+#endif
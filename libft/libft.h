@@ -26,5 +26,7 @@ char	**ft_split(char const *s, char c);
 void	ft_free_split(char **split);
 int		ft_isalpha(int c);
 int		ft_isalnum(int c);
+void	*ft_memcpy(void *dst, const void *src, size_t n);
+void	*ft_memchr(const void *s, int c, size_t n);
 
 #endif
@@ -29,6 +29,8 @@ int	is_builtin(char *command)
 		return (1);
 	if (ft_strcmp(command, "exit") == 0)
 		return (1);
+	if (ft_strcmp(command, "hash") == 0)
+		return (1);
 	return (0);
 }
 
@@ -48,5 +50,7 @@ int	exec_builtin(char **argv, t_exec_ctx *ctx)
 		return (builtin_env(argv, ctx));
 	if (ft_strcmp(argv[0], "exit") == 0)
 		return (builtin_exit(argv, ctx));
+	if (ft_strcmp(argv[0], "hash") == 0)
+		return (builtin_hash(argv, ctx));
 	return (1);
 }
@@ -15,10 +15,10 @@
 
 int	builtin_env(char **argv, t_exec_ctx *ctx)
 {
-	t_env	*curr;
+	t_env_var	*curr;
 
 	(void)argv;
-	curr = ctx->env;
+	curr = ctx->env->head;
 	while (curr)
 	{
 		printf("%s=%s\n", curr->key, curr->value);
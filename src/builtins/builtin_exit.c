@@ -60,7 +60,8 @@ int	builtin_exit(char **argv, t_exec_ctx *ctx)
 {
 	int	code;
 
-	printf("exit\n");
+	if (ctx->interactive)
+		printf("exit\n");
 	if (!argv[1])
 		exit(ctx->last_status);
 	if (!is_numeric(argv[1]))
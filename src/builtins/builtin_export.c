@@ -16,9 +16,9 @@
 
 static void	print_all_vars(t_exec_ctx *ctx)
 {
-	t_env	*curr;
+	t_env_var	*curr;
 
-	curr = ctx->env;
+	curr = ctx->env->head;
 	while (curr)
 	{
 		printf("declare -x %s=\"%s\"\n", curr->key, curr->value);
@@ -71,6 +71,7 @@ int	builtin_export(char **argv, t_exec_ctx *ctx)
 		if (parse_export_arg(argv[i], &key, &value))
 		{
 			env_set(&ctx->env, key, value);
+			exec_env_changed(ctx, key);
 			free(key);
 			free(value);
 		}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+#include "../../libft/libft.h"
+#include <stdio.h>
+
+static void	print_hash_table(t_exec_ctx *ctx)
+{
+	t_hash_entry	*curr;
+	int				printed;
+	int				i;
+
+	printed = 0;
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		curr = ctx->cmd_hash[i];
+		while (curr)
+		{
+			if (!printed++)
+				printf("hits\tcommand\n");
+			printf("%4d\t%s\n", curr->hits, curr->path);
+			curr = curr->next;
+		}
+		i++;
+	}
+	if (!printed)
+		printf("hash: hash table empty\n");
+}
+
+static int	hash_prefill(char *name, t_exec_ctx *ctx)
+{
+	t_hash_entry	*entry;
+	char			*path;
+
+	if (is_builtin(name) || ft_strchr(name, '/'))
+		return (0);
+	entry = cmd_hash_find(ctx, name);
+	if (entry)
+		return (0);
+	path = resolve_path(name, ctx->env);
+	if (!path)
+	{
+		fprintf(stderr, "minishell: hash: %s: not found\n", name);
+		return (1);
+	}
+	cmd_hash_add(ctx, name, path);
+	free(path);
+	return (0);
+}
+
+static int	parse_hash_options(char **argv, int *i, t_exec_ctx *ctx)
+{
+	while (argv[*i] && argv[*i][0] == '-' && argv[*i][1])
+	{
+		if (ft_strcmp(argv[*i], "-r") != 0)
+		{
+			fprintf(stderr, "minishell: hash: %s: invalid option\n",
+				argv[*i]);
+			fprintf(stderr, "hash: usage: hash [-r] [name ...]\n");
+			return (0);
+		}
+		cmd_hash_clear(ctx);
+		(*i)++;
+	}
+	return (1);
+}
+
+int	builtin_hash(char **argv, t_exec_ctx *ctx)
+{
+	int	status;
+	int	i;
+
+	i = 1;
+	if (!parse_hash_options(argv, &i, ctx))
+		return (2);
+	if (i == 1 && !argv[i])
+	{
+		print_hash_table(ctx);
+		return (0);
+	}
+	status = 0;
+	while (argv[i])
+	{
+		if (hash_prefill(argv[i], ctx))
+			status = 1;
+		i++;
+	}
+	return (status);
+}
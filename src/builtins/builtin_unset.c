@@ -22,6 +22,7 @@ int	builtin_unset(char **argv, t_exec_ctx *ctx)
 	while (argv[i])
 	{
 		env_unset(&ctx->env, argv[i]);
+		exec_env_changed(ctx, argv[i]);
 		i++;
 	}
 	return (0);
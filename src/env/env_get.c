@@ -13,23 +13,72 @@
 #include "../../includes/env.h"
 #include "../../libft/libft.h"
 
-t_env	*env_find(t_env *env, char *key)
+t_env_var	*env_find(t_env *env, char *key)
 {
-	t_env	*curr;
+	unsigned int	idx;
 
-	curr = env;
-	while (curr)
+	if (!env || !key)
+		return (NULL);
+	idx = env_slot_of(env, key, env_hash(key));
+	return (env->slots[idx]);
+}
+
+static int	key_matches(char *key, char *name, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (key[i] != name[i])
+			return (0);
+		i++;
+	}
+	return (key[i] == '\0');
+}
+
+static unsigned int	env_hash_n(char *name, size_t len)
+{
+	unsigned int	hash;
+	size_t			i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619u;
+		i++;
+	}
+	return (hash);
+}
+
+char	*env_get_n(t_env *env, char *name, size_t len)
+{
+	unsigned int	hash;
+	unsigned int	mask;
+	unsigned int	idx;
+	t_env_var		*var;
+
+	if (!env)
+		return (NULL);
+	hash = env_hash_n(name, len);
+	mask = env->capacity - 1;
+	idx = hash & mask;
+	var = env->slots[idx];
+	while (var)
 	{
-		if (ft_strcmp(curr->key, key) == 0)
-			return (curr);
-		curr = curr->next;
+		if (var->hash == hash && key_matches(var->key, name, len))
+			return (var->value);
+		idx = (idx + 1) & mask;
+		var = env->slots[idx];
 	}
 	return (NULL);
 }
 
 char	*env_get(t_env *env, char *key)
 {
-	t_env	*node;
+	t_env_var	*node;
 
 	node = env_find(env, key);
 	if (!node)
@@ -47,40 +47,31 @@ static char	*extract_value(char *env_line)
 	return (ft_strdup(env_line + i + 1));
 }
 
-static void	append_env_node(t_env **head, t_env *new)
+static unsigned int	initial_capacity(char **environ)
 {
-	t_env	*curr;
+	unsigned int	capacity;
+	unsigned int	count;
 
-	if (!*head)
-	{
-		*head = new;
-		return ;
-	}
-	curr = *head;
-	while (curr->next)
-		curr = curr->next;
-	curr->next = new;
+	count = 0;
+	while (environ[count])
+		count++;
+	capacity = ENV_INIT_CAPACITY;
+	while (capacity < count * 2)
+		capacity *= 2;
+	return (capacity);
 }
 
 static void	process_env_line(t_env **env, char *line)
 {
-	t_env	*node;
 	char	*key;
 	char	*value;
 
 	key = extract_key(line);
 	value = extract_value(line);
-	if (!key || !value)
-	{
-		free(key);
-		free(value);
-		return ;
-	}
-	node = env_node_new(key, value);
+	if (key && value)
+		env_set(env, key, value);
 	free(key);
 	free(value);
-	if (node)
-		append_env_node(env, node);
 }
 
 t_env	*init_env(char **environ)
@@ -88,7 +79,9 @@ t_env	*init_env(char **environ)
 	t_env	*env;
 	int		i;
 
-	env = NULL;
+	env = env_table_new(initial_capacity(environ));
+	if (!env)
+		return (NULL);
 	i = 0;
 	while (environ[i])
 	{
@@ -14,7 +14,7 @@
 #include "../../libft/libft.h"
 #include <stdlib.h>
 
-static int	env_update(t_env *node, char *value)
+static int	env_update(t_env_var *node, char *value)
 {
 	char	*new_value;
 
@@ -26,32 +26,31 @@ static int	env_update(t_env *node, char *value)
 	return (1);
 }
 
-static void	env_append(t_env **env, t_env *new)
+int	env_set(t_env **env, char *key, char *value)
 {
-	t_env	*curr;
+	t_env_var	*node;
 
 	if (!*env)
 	{
-		*env = new;
-		return ;
+		*env = env_table_new(ENV_INIT_CAPACITY);
+		if (!*env)
+			return (0);
 	}
-	curr = *env;
-	while (curr->next)
-		curr = curr->next;
-	curr->next = new;
-}
-
-int	env_set(t_env **env, char *key, char *value)
-{
-	t_env	*node;
-	t_env	*new;
-
 	node = env_find(*env, key);
 	if (node)
+	{
+		(*env)->dirty = 1;
 		return (env_update(node, value));
-	new = env_node_new(key, value);
-	if (!new)
+	}
+	node = env_node_new(key, value);
+	if (!node)
 		return (0);
-	env_append(env, new);
+	if (!env_table_insert(*env, node))
+	{
+		free(node->key);
+		free(node->value);
+		free(node);
+		return (0);
+	}
 	return (1);
 }
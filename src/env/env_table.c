@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/env.h"
+#include "../../libft/libft.h"
+#include <stdlib.h>
+
+unsigned int	env_hash(char *key)
+{
+	unsigned int	hash;
+	int				i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (key[i])
+	{
+		hash ^= (unsigned char)key[i];
+		hash *= 16777619u;
+		i++;
+	}
+	return (hash);
+}
+
+t_env	*env_table_new(unsigned int capacity)
+{
+	t_env			*env;
+	unsigned int	i;
+
+	env = (t_env *)malloc(sizeof(t_env));
+	if (!env)
+		return (NULL);
+	env->slots = (t_env_var **)malloc(sizeof(t_env_var *) * capacity);
+	if (!env->slots)
+	{
+		free(env);
+		return (NULL);
+	}
+	i = 0;
+	while (i < capacity)
+		env->slots[i++] = NULL;
+	env->capacity = capacity;
+	env->count = 0;
+	env->head = NULL;
+	env->tail = NULL;
+	env->dirty = 1;
+	return (env);
+}
+
+unsigned int	env_slot_of(t_env *env, char *key, unsigned int hash)
+{
+	unsigned int	mask;
+	unsigned int	idx;
+	t_env_var		*var;
+
+	mask = env->capacity - 1;
+	idx = hash & mask;
+	var = env->slots[idx];
+	while (var)
+	{
+		if (var->hash == hash && ft_strcmp(var->key, key) == 0)
+			return (idx);
+		idx = (idx + 1) & mask;
+		var = env->slots[idx];
+	}
+	return (idx);
+}
+
+static int	env_table_grow(t_env *env)
+{
+	t_env_var		**slots;
+	t_env_var		*curr;
+	unsigned int	mask;
+	unsigned int	idx;
+
+	slots = (t_env_var **)malloc(sizeof(t_env_var *) * env->capacity * 2);
+	if (!slots)
+		return (0);
+	idx = 0;
+	while (idx < env->capacity * 2)
+		slots[idx++] = NULL;
+	free(env->slots);
+	env->slots = slots;
+	env->capacity *= 2;
+	mask = env->capacity - 1;
+	curr = env->head;
+	while (curr)
+	{
+		idx = curr->hash & mask;
+		while (slots[idx])
+			idx = (idx + 1) & mask;
+		slots[idx] = curr;
+		curr = curr->next;
+	}
+	return (1);
+}
+
+int	env_table_insert(t_env *env, t_env_var *var)
+{
+	unsigned int	idx;
+
+	if ((unsigned int)(env->count + 1) * 2 > env->capacity)
+	{
+		if (!env_table_grow(env))
+			return (0);
+	}
+	idx = env_slot_of(env, var->key, var->hash);
+	env->slots[idx] = var;
+	var->prev = env->tail;
+	var->next = NULL;
+	if (env->tail)
+		env->tail->next = var;
+	else
+		env->head = var;
+	env->tail = var;
+	env->count++;
+	env->dirty = 1;
+	return (1);
+}
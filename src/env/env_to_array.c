@@ -23,10 +23,10 @@ static void	free_partial_envp(char **envp, int count)
 
 static char	**fill_envp(char **envp, t_env *env)
 {
-	t_env	*curr;
-	int		i;
+	t_env_var	*curr;
+	int			i;
 
-	curr = env;
+	curr = env->head;
 	i = 0;
 	while (curr)
 	{
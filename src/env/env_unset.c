@@ -14,49 +14,78 @@
 #include "../../libft/libft.h"
 #include <stdlib.h>
 
+static void	free_env_node(t_env_var *node)
+{
+	free(node->key);
+	free(node->value);
+	free(node);
+}
+
 void	free_env(t_env *env)
 {
-	t_env	*next;
+	t_env_var	*next;
 
-	while (env)
+	if (!env)
+		return ;
+	while (env->head)
 	{
-		next = env->next;
-		free(env->key);
-		free(env->value);
-		free(env);
-		env = next;
+		next = env->head->next;
+		free_env_node(env->head);
+		env->head = next;
 	}
+	free(env->slots);
+	free(env);
 }
 
-static void	free_env_node(t_env *node)
+static void	env_slot_remove(t_env *env, unsigned int hole)
 {
-	free(node->key);
-	free(node->value);
-	free(node);
+	unsigned int	mask;
+	unsigned int	next;
+	unsigned int	home;
+
+	mask = env->capacity - 1;
+	env->slots[hole] = NULL;
+	next = (hole + 1) & mask;
+	while (env->slots[next])
+	{
+		home = env->slots[next]->hash & mask;
+		if (((next - home) & mask) >= ((next - hole) & mask))
+		{
+			env->slots[hole] = env->slots[next];
+			env->slots[next] = NULL;
+			hole = next;
+		}
+		next = (next + 1) & mask;
+	}
+}
+
+static void	env_unlink(t_env *env, t_env_var *var)
+{
+	if (var->prev)
+		var->prev->next = var->next;
+	else
+		env->head = var->next;
+	if (var->next)
+		var->next->prev = var->prev;
+	else
+		env->tail = var->prev;
 }
 
 int	env_unset(t_env **env, char *key)
 {
-	t_env	*curr;
-	t_env	*prev;
+	t_env_var		*var;
+	unsigned int	idx;
 
-	if (!*env)
+	if (!*env || !key)
 		return (0);
-	curr = *env;
-	prev = NULL;
-	while (curr)
-	{
-		if (ft_strcmp(curr->key, key) == 0)
-		{
-			if (prev)
-				prev->next = curr->next;
-			else
-				*env = curr->next;
-			free_env_node(curr);
-			return (1);
-		}
-		prev = curr;
-		curr = curr->next;
-	}
-	return (0);
+	idx = env_slot_of(*env, key, env_hash(key));
+	var = (*env)->slots[idx];
+	if (!var)
+		return (0);
+	env_slot_remove(*env, idx);
+	env_unlink(*env, var);
+	free_env_node(var);
+	(*env)->count--;
+	(*env)->dirty = 1;
+	return (1);
 }
@@ -14,11 +14,11 @@
 #include "../../libft/libft.h"
 #include <stdlib.h>
 
-t_env	*env_node_new(char *key, char *value)
+t_env_var	*env_node_new(char *key, char *value)
 {
-	t_env	*node;
+	t_env_var	*node;
 
-	node = (t_env *)malloc(sizeof(t_env));
+	node = (t_env_var *)malloc(sizeof(t_env_var));
 	if (!node)
 		return (NULL);
 	node->key = ft_strdup(key);
@@ -30,34 +30,43 @@ t_env	*env_node_new(char *key, char *value)
 		free(node);
 		return (NULL);
 	}
+	node->hash = env_hash(key);
+	node->prev = NULL;
 	node->next = NULL;
 	return (node);
 }
 
 int	env_count(t_env *env)
 {
-	int		count;
-	t_env	*curr;
-
-	count = 0;
-	curr = env;
-	while (curr)
-	{
-		count++;
-		curr = curr->next;
-	}
-	return (count);
+	if (!env)
+		return (0);
+	return (env->count);
 }
 
-char	*env_to_string(t_env *node)
+char	*env_to_string(t_env_var *node)
 {
 	char	*result;
-	char	*temp;
+	size_t	key_len;
+	size_t	val_len;
+	size_t	i;
 
-	temp = ft_strjoin(node->key, "=");
-	if (!temp)
+	key_len = ft_strlen(node->key);
+	val_len = ft_strlen(node->value);
+	result = (char *)malloc(key_len + val_len + 2);
+	if (!result)
 		return (NULL);
-	result = ft_strjoin(temp, node->value);
-	free(temp);
+	i = 0;
+	while (i < key_len)
+	{
+		result[i] = node->key[i];
+		i++;
+	}
+	result[i++] = '=';
+	while (i < key_len + 1 + val_len)
+	{
+		result[i] = node->value[i - key_len - 1];
+		i++;
+	}
+	result[i] = '\0';
 	return (result);
 }
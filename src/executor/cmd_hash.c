@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_hash.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../libft/libft.h"
+#include <stdlib.h>
+
+static unsigned int	cmd_hash_index(char *name)
+{
+	unsigned int	hash;
+	int				i;
+
+	hash = 5381;
+	i = 0;
+	while (name[i])
+	{
+		hash = hash * 33 + (unsigned char)name[i];
+		i++;
+	}
+	return (hash % CMD_HASH_SIZE);
+}
+
+t_hash_entry	*cmd_hash_find(t_exec_ctx *ctx, char *name)
+{
+	t_hash_entry	*curr;
+
+	curr = ctx->cmd_hash[cmd_hash_index(name)];
+	while (curr)
+	{
+		if (ft_strcmp(curr->name, name) == 0)
+			return (curr);
+		curr = curr->next;
+	}
+	return (NULL);
+}
+
+t_hash_entry	*cmd_hash_add(t_exec_ctx *ctx, char *name, char *path)
+{
+	t_hash_entry	*entry;
+	unsigned int	idx;
+
+	entry = (t_hash_entry *)malloc(sizeof(t_hash_entry));
+	if (!entry)
+		return (NULL);
+	entry->name = ft_strdup(name);
+	entry->path = ft_strdup(path);
+	if (!entry->name || !entry->path)
+	{
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return (NULL);
+	}
+	entry->hits = 0;
+	idx = cmd_hash_index(name);
+	entry->next = ctx->cmd_hash[idx];
+	ctx->cmd_hash[idx] = entry;
+	return (entry);
+}
+
+void	cmd_hash_clear(t_exec_ctx *ctx)
+{
+	t_hash_entry	*next;
+	int				i;
+
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		while (ctx->cmd_hash[i])
+		{
+			next = ctx->cmd_hash[i]->next;
+			free(ctx->cmd_hash[i]->name);
+			free(ctx->cmd_hash[i]->path);
+			free(ctx->cmd_hash[i]);
+			ctx->cmd_hash[i] = next;
+		}
+		i++;
+	}
+}
+
+void	cmd_hash_env_changed(t_exec_ctx *ctx, char *key)
+{
+	if (key && ft_strcmp(key, "PATH") == 0)
+		cmd_hash_clear(ctx);
+}
@@ -12,66 +12,48 @@
 
 #include "../../includes/executor.h"
 #include "../../includes/builtins.h"
-#include "../../includes/signals.h"
 #include "../../includes/expander.h"
 #include <sys/wait.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdio.h>
 
-int	wait_child(int pid)
+int	wait_child(int pid, t_exec_ctx *ctx)
 {
-	int	status;
+	long long	start;
+	int			status;
 
+	start = timing_start(&ctx->timing);
 	waitpid(pid, &status, 0);
+	timing_add(&ctx->timing, PHASE_WAIT, start);
 	if (WIFEXITED(status))
-		return (WEXITSTATUS(status));
-	if (WIFSIGNALED(status))
-		return (128 + WTERMSIG(status));
-	return (1);
-}
-
-int	exec_external(char **argv, t_env *env)
-{
-	char	*path;
-	char	**envp;
-
-	default_signals();
-	path = resolve_path(argv[0], env);
-	if (!path)
-	{
-		fprintf(stderr, "minishell: %s: command not found\n", argv[0]);
-		exit(127);
-	}
-	envp = env_to_envp(env);
-	if (!envp)
-		exit(1);
-	execve(path, argv, envp);
-	perror("minishell");
-	free(path);
-	free_envp(envp);
-	exit(126);
+		status = WEXITSTATUS(status);
+	else if (WIFSIGNALED(status))
+		status = 128 + WTERMSIG(status);
+	else
+		status = 1;
+	trace_reaped(&ctx->trace, pid, status);
+	return (status);
 }
 
-static int	exec_forked(char **argv, t_env *env)
+static int	run_builtin(t_cmd_node *cmd, t_exec_ctx *ctx)
 {
-	int	pid;
 	int	status;
 
-	pid = fork();
-	if (pid < 0)
-	{
-		perror("minishell: fork");
-		return (1);
-	}
-	if (pid == 0)
-		exec_external(argv, env);
-	ignore_signals();
-	status = wait_child(pid);
-	init_signals();
+	if (cmd->redirects && setup_redirects(cmd->redirects, ctx) == -1)
+		status = 1;
+	else
+		status = exec_builtin(cmd->argv, ctx);
+	fflush(stdout);
+	if (cmd->redirects)
+		restore_redirects(ctx);
 	return (status);
 }
 
+/*
+** The parsed argv belongs to the line arena; a glob-expanded argv is
+** heap-allocated and swapped back out once the command has run.
+*/
 static void	apply_wildcard_expansion(t_cmd_node *cmd, char ***old)
 {
 	char	**expanded;
@@ -94,20 +76,16 @@ int	exec_command(t_cmd_node *cmd, t_exec_ctx *ctx)
 	if (!cmd->argv || !cmd->argv[0])
 		return (0);
 	apply_wildcard_expansion(cmd, &old_argv);
-	if (cmd->redirects)
-	{
-		if (process_all_heredocs(cmd->redirects, ctx) == -1)
-			return (1);
-		if (setup_redirects(cmd->redirects, ctx) == -1)
-			return (1);
-	}
-	if (is_builtin(cmd->argv[0]))
-		status = exec_builtin(cmd->argv, ctx);
+	if (cmd->redirects && expand_heredocs(cmd->redirects, ctx) == -1)
+		status = 1;
+	else if (is_builtin(cmd->argv[0]))
+		status = run_builtin(cmd, ctx);
 	else
-		status = exec_forked(cmd->argv, ctx->env);
-	if (cmd->redirects)
-		restore_redirects(ctx);
+		status = run_external(cmd, ctx);
 	if (old_argv)
-		free_argv(old_argv);
+	{
+		free_argv(cmd->argv);
+		cmd->argv = old_argv;
+	}
 	return (status);
 }
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_external.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../includes/signals.h"
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+int	exec_external(char **argv, char *path, char **envp)
+{
+	default_signals();
+	if (!path)
+	{
+		fprintf(stderr, "minishell: %s: command not found\n", argv[0]);
+		exit(127);
+	}
+	execve(path, argv, envp);
+	perror("minishell");
+	free(path);
+	exit(126);
+}
+
+/*
+** The forked child applies the redirections itself, so the shell never
+** touches its own stdin/stdout for an external command.
+*/
+static void	exec_child(t_cmd_node *cmd, char *path, char **envp,
+				t_exec_ctx *ctx)
+{
+	if (apply_redirects(cmd->redirects, ctx) == -1)
+		exit(1);
+	exec_external(cmd->argv, path, envp);
+}
+
+static int	exec_forked(t_cmd_node *cmd, char *path, t_exec_ctx *ctx)
+{
+	char		**envp;
+	long long	start;
+	int			pid;
+	int			status;
+
+	envp = exec_envp(ctx);
+	if (!envp)
+		return (1);
+	start = exec_clock(ctx);
+	pid = fork();
+	if (pid < 0)
+	{
+		perror("minishell: fork");
+		return (1);
+	}
+	if (pid == 0)
+		exec_child(cmd, path, envp, ctx);
+	exec_spawn_done(ctx, pid, cmd->argv[0], start);
+	ignore_signals();
+	status = wait_child(pid, ctx);
+	init_signals();
+	return (status);
+}
+
+/*
+** Tail position: nothing runs after this command, so apply the
+** redirections to the shell's own fds and let execve replace it.
+*/
+static int	exec_in_place(t_cmd_node *cmd, char *path, t_exec_ctx *ctx)
+{
+	char	**envp;
+
+	if (apply_redirects(cmd->redirects, ctx) == -1)
+		return (free(path), 1);
+	envp = exec_envp(ctx);
+	if (!envp)
+		return (free(path), 1);
+	exec_external(cmd->argv, path, envp);
+	return (1);
+}
+
+int	run_external(t_cmd_node *cmd, t_exec_ctx *ctx)
+{
+	char	*path;
+	int		status;
+
+	path = resolve_cached(cmd->argv[0], ctx);
+	if (ctx->exec_tail)
+		return (exec_in_place(cmd, path, ctx));
+	if (path && ctx->spawn_enabled
+		&& exec_spawned(cmd, path, ctx, &status) == 0)
+	{
+		free(path);
+		return (status);
+	}
+	status = exec_forked(cmd, path, ctx);
+	free(path);
+	return (status);
+}
@@ -12,11 +12,23 @@
 
 #include "../../includes/executor.h"
 
+static int	exec_left(t_ast_node *left, t_exec_ctx *ctx)
+{
+	int	tail;
+	int	status;
+
+	tail = ctx->exec_tail;
+	ctx->exec_tail = 0;
+	status = execute_ast(left, ctx);
+	ctx->exec_tail = tail;
+	return (status);
+}
+
 int	exec_and(t_binop_node *and_node, t_exec_ctx *ctx)
 {
 	int	status;
 
-	status = execute_ast(and_node->left, ctx);
+	status = exec_left(and_node->left, ctx);
 	ctx->last_status = status;
 	if (status == 0)
 		status = execute_ast(and_node->right, ctx);
@@ -27,7 +39,7 @@ int	exec_or(t_binop_node *or_node, t_exec_ctx *ctx)
 {
 	int	status;
 
-	status = execute_ast(or_node->left, ctx);
+	status = exec_left(or_node->left, ctx);
 	ctx->last_status = status;
 	if (status != 0)
 		status = execute_ast(or_node->right, ctx);
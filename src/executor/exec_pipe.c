@@ -15,36 +15,38 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/wait.h>
 
-static void	exec_pipe_child(t_ast_node *node, t_exec_ctx *ctx)
+static void	exec_pipe_child(t_ast_node *node, int in_fd, int fds[2],
+				t_exec_ctx *ctx)
 {
 	int	status;
 
-	default_signals();
-	status = execute_ast(node, ctx);
-	cleanup_exec_ctx(ctx);
-	exit(status);
-}
-
-static void	setup_pipe_fds(int in_fd, int out_fd)
-{
+	if (fds[0] != -1)
+		close(fds[0]);
 	if (in_fd != -1)
 	{
 		dup2(in_fd, STDIN_FILENO);
 		close(in_fd);
 	}
-	if (out_fd != -1)
+	if (fds[1] != -1)
 	{
-		dup2(out_fd, STDOUT_FILENO);
-		close(out_fd);
+		dup2(fds[1], STDOUT_FILENO);
+		close(fds[1]);
 	}
+	default_signals();
+	ctx->exec_tail = 1;
+	status = execute_ast(node, ctx);
+	cleanup_exec_ctx(ctx);
+	exit(status);
 }
 
-static int	fork_pipe_cmd(t_ast_node *node, int fds[2], t_exec_ctx *ctx)
+static int	fork_stage(t_ast_node *node, int in_fd, int fds[2],
+				t_exec_ctx *ctx)
 {
-	int	pid;
+	long long	start;
+	int			pid;
 
+	start = exec_clock(ctx);
 	pid = fork();
 	if (pid < 0)
 	{
@@ -52,45 +54,70 @@ static int	fork_pipe_cmd(t_ast_node *node, int fds[2], t_exec_ctx *ctx)
 		return (-1);
 	}
 	if (pid == 0)
-	{
-		setup_pipe_fds(fds[0], fds[1]);
-		exec_pipe_child(node, ctx);
-	}
+		exec_pipe_child(node, in_fd, fds, ctx);
+	exec_spawn_done(ctx, pid, exec_node_name(node), start);
 	return (pid);
 }
 
-static int	wait_pipe_children(int pid_left, int pid_right)
+static void	rotate_pipe_fds(int *prev_read, int fds[2])
 {
-	int	status;
+	if (*prev_read != -1)
+		close(*prev_read);
+	if (fds[1] != -1)
+		close(fds[1]);
+	*prev_read = fds[0];
+}
 
-	ignore_signals();
-	waitpid(pid_left, NULL, 0);
-	waitpid(pid_right, &status, 0);
-	init_signals();
-	if (WIFEXITED(status))
-		return (WEXITSTATUS(status));
-	return (1);
+static int	start_stages(t_pipeline_node *pl, int *pids, t_exec_ctx *ctx)
+{
+	int	fds[2];
+	int	prev_read;
+	int	i;
+
+	prev_read = -1;
+	i = 0;
+	while (i < pl->count)
+	{
+		fds[0] = -1;
+		fds[1] = -1;
+		if (i < pl->count - 1 && pipe(fds) == -1)
+		{
+			perror("minishell: pipe");
+			break ;
+		}
+		pids[i] = fork_stage(pl->stages[i], prev_read, fds, ctx);
+		rotate_pipe_fds(&prev_read, fds);
+		if (pids[i++] == -1)
+			break ;
+	}
+	if (prev_read != -1)
+		close(prev_read);
+	return (i);
 }
 
-int	exec_pipe(t_binop_node *pipe_node, t_exec_ctx *ctx)
+int	exec_pipe(t_pipeline_node *pipeline, t_exec_ctx *ctx)
 {
-	int		pipefd[2];
-	int		fds[2];
-	int		pid[2];
+	int	*pids;
+	int	started;
+	int	status;
+	int	i;
 
-	if (pipe(pipefd) == -1)
-		return (perror("minishell: pipe"), 1);
-	fds[0] = -1;
-	fds[1] = pipefd[1];
-	pid[0] = fork_pipe_cmd(pipe_node->left, fds, ctx);
-	close(pipefd[1]);
-	if (pid[0] == -1)
-		return (close(pipefd[0]), 1);
-	fds[0] = pipefd[0];
-	fds[1] = -1;
-	pid[1] = fork_pipe_cmd(pipe_node->right, fds, ctx);
-	close(pipefd[0]);
-	if (pid[1] == -1)
+	pids = (int *)malloc(sizeof(int) * pipeline->count);
+	if (!pids)
 		return (1);
-	return (wait_pipe_children(pid[0], pid[1]));
+	started = start_stages(pipeline, pids, ctx);
+	status = 1;
+	ignore_signals();
+	i = 0;
+	while (i < started)
+	{
+		if (pids[i] != -1)
+			status = wait_child(pids[i], ctx);
+		i++;
+	}
+	init_signals();
+	if (started < pipeline->count || pids[started - 1] == -1)
+		status = 1;
+	free(pids);
+	return (status);
 }
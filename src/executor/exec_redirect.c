@@ -33,10 +33,14 @@ static int	open_redir_file(t_redirect *redir)
 	return (fd);
 }
 
+/*
+** Heredoc files stay open: the line owns them (close_all_heredocs).
+*/
 static int	apply_single_redir(t_redirect *redir)
 {
 	int	fd;
 	int	target_fd;
+	int	ret;
 
 	fd = open_redir_file(redir);
 	if (fd == -1)
@@ -44,32 +48,48 @@ static int	apply_single_redir(t_redirect *redir)
 	target_fd = STDOUT_FILENO;
 	if (redir->type == REDIR_IN || redir->type == REDIR_HEREDOC)
 		target_fd = STDIN_FILENO;
-	if (dup2(fd, target_fd) == -1)
-	{
+	ret = dup2(fd, target_fd);
+	if (redir->type != REDIR_HEREDOC)
 		close(fd);
+	if (ret == -1)
+	{
 		perror("minishell: dup2");
 		return (-1);
 	}
-	close(fd);
 	return (0);
 }
 
-int	setup_redirects(t_redirect *redir, t_exec_ctx *ctx)
+/*
+** Apply the redirections to the current process without saving the old
+** stdin/stdout: for children, which exit or exec with them in place.
+*/
+int	apply_redirects(t_redirect *redir, t_exec_ctx *ctx)
 {
-	t_redirect	*curr;
+	long long	start;
+	int			ret;
+
+	start = exec_clock(ctx);
+	ret = 0;
+	while (redir && ret == 0)
+	{
+		ret = apply_single_redir(redir);
+		redir = redir->next;
+	}
+	trace_event(&ctx->trace, "redirects", start, ret);
+	return (ret);
+}
 
+/*
+** Builtins run in the shell itself: stdin/stdout are saved first and put
+** back by restore_redirects.
+*/
+int	setup_redirects(t_redirect *redir, t_exec_ctx *ctx)
+{
 	ctx->stdin_backup = dup(STDIN_FILENO);
 	ctx->stdout_backup = dup(STDOUT_FILENO);
 	if (ctx->stdin_backup == -1 || ctx->stdout_backup == -1)
 		return (-1);
-	curr = redir;
-	while (curr)
-	{
-		if (apply_single_redir(curr) == -1)
-			return (-1);
-		curr = curr->next;
-	}
-	return (0);
+	return (apply_redirects(redir, ctx));
 }
 
 void	restore_redirects(t_exec_ctx *ctx)
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_spawn.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../includes/signals.h"
+#include <spawn.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdio.h>
+
+static int	add_redir_action(posix_spawn_file_actions_t *fa, t_redirect *redir)
+{
+	if (redir->type == REDIR_IN)
+		return (posix_spawn_file_actions_addopen(fa, STDIN_FILENO,
+				redir->file, O_RDONLY, 0));
+	if (redir->type == REDIR_OUT)
+		return (posix_spawn_file_actions_addopen(fa, STDOUT_FILENO,
+				redir->file, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+	if (redir->type == REDIR_APPEND)
+		return (posix_spawn_file_actions_addopen(fa, STDOUT_FILENO,
+				redir->file, O_WRONLY | O_CREAT | O_APPEND, 0644));
+	if (redir->heredoc_fd == -1)
+		return (-1);
+	if (posix_spawn_file_actions_adddup2(fa, redir->heredoc_fd, 0) != 0)
+		return (-1);
+	return (posix_spawn_file_actions_addclose(fa, redir->heredoc_fd));
+}
+
+static int	build_spawn_actions(posix_spawn_file_actions_t *fa,
+				t_redirect *redir)
+{
+	if (posix_spawn_file_actions_init(fa) != 0)
+		return (-1);
+	while (redir)
+	{
+		if (add_redir_action(fa, redir) != 0)
+		{
+			posix_spawn_file_actions_destroy(fa);
+			return (-1);
+		}
+		redir = redir->next;
+	}
+	return (0);
+}
+
+static int	build_spawn_attr(posix_spawnattr_t *attr)
+{
+	sigset_t	sigs;
+
+	if (posix_spawnattr_init(attr) != 0)
+		return (-1);
+	sigemptyset(&sigs);
+	sigaddset(&sigs, SIGINT);
+	sigaddset(&sigs, SIGQUIT);
+	posix_spawnattr_setsigdefault(attr, &sigs);
+	sigemptyset(&sigs);
+	posix_spawnattr_setsigmask(attr, &sigs);
+	posix_spawnattr_setflags(attr, POSIX_SPAWN_SETSIGDEF
+		| POSIX_SPAWN_SETSIGMASK);
+	return (0);
+}
+
+static int	spawn_command(t_cmd_node *cmd, char *path, char **envp, int *pid)
+{
+	posix_spawn_file_actions_t	fa;
+	posix_spawnattr_t			attr;
+	pid_t						child;
+	int							ret;
+
+	if (build_spawn_attr(&attr) != 0)
+		return (-1);
+	if (build_spawn_actions(&fa, cmd->redirects) != 0)
+	{
+		posix_spawnattr_destroy(&attr);
+		return (-1);
+	}
+	ret = posix_spawn(&child, path, &fa, &attr, cmd->argv, envp);
+	posix_spawn_file_actions_destroy(&fa);
+	posix_spawnattr_destroy(&attr);
+	*pid = -1;
+	if (ret == 0)
+		*pid = child;
+	return (ret);
+}
+
+int	exec_spawned(t_cmd_node *cmd, char *path, t_exec_ctx *ctx, int *status)
+{
+	char		**envp;
+	long long	start;
+	int			pid;
+	int			ret;
+
+	envp = exec_envp(ctx);
+	if (!envp)
+		return (-1);
+	start = exec_clock(ctx);
+	ret = spawn_command(cmd, path, envp, &pid);
+	exec_spawn_done(ctx, pid, cmd->argv[0], start);
+	if (ret == -1 || (ret != 0 && cmd->redirects))
+		return (-1);
+	close_heredoc_fds(cmd->redirects);
+	if (ret != 0)
+	{
+		errno = ret;
+		perror("minishell");
+		*status = 126;
+		return (0);
+	}
+	ignore_signals();
+	*status = wait_child(pid, ctx);
+	init_signals();
+	return (0);
+}
@@ -22,11 +22,11 @@ static void	exec_subshell_child(t_subshell_node *subshell, t_exec_ctx *ctx)
 	int	status;
 
 	default_signals();
-	if (subshell->redirects)
-	{
-		process_all_heredocs(subshell->redirects, ctx);
-		setup_redirects(subshell->redirects, ctx);
-	}
+	if (subshell->redirects
+		&& (expand_heredocs(subshell->redirects, ctx) == -1
+			|| apply_redirects(subshell->redirects, ctx) == -1))
+		exit(1);
+	ctx->exec_tail = 1;
 	status = execute_ast(subshell->child, ctx);
 	cleanup_exec_ctx(ctx);
 	exit(status);
@@ -34,9 +34,13 @@ static void	exec_subshell_child(t_subshell_node *subshell, t_exec_ctx *ctx)
 
 int	exec_subshell(t_subshell_node *subshell, t_exec_ctx *ctx)
 {
-	int	pid;
-	int	status;
+	long long	start;
+	int			pid;
+	int			status;
 
+	if (ctx->exec_tail)
+		exec_subshell_child(subshell, ctx);
+	start = exec_clock(ctx);
 	pid = fork();
 	if (pid < 0)
 	{
@@ -45,8 +49,9 @@ int	exec_subshell(t_subshell_node *subshell, t_exec_ctx *ctx)
 	}
 	if (pid == 0)
 		exec_subshell_child(subshell, ctx);
+	exec_spawn_done(ctx, pid, "subshell", start);
 	ignore_signals();
-	status = wait_child(pid);
+	status = wait_child(pid, ctx);
 	init_signals();
 	return (status);
 }
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_trace.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+
+/*
+** Start of a span that timing or the trace may record; 0 when both are
+** off, so that no clock is read.
+*/
+long long	exec_clock(t_exec_ctx *ctx)
+{
+	if (ctx->timing.fd < 0 && ctx->trace.fd < 0)
+		return (0);
+	return (timing_now());
+}
+
+/*
+** Called in the parent once fork or posix_spawn has returned; the
+** child's trace event is written by wait_child.
+*/
+void	exec_spawn_done(t_exec_ctx *ctx, int pid, const char *name,
+		long long start)
+{
+	timing_add(&ctx->timing, PHASE_SPAWN, start);
+	trace_spawned(&ctx->trace, pid, name, start);
+}
+
+/*
+** Trace name of a pipeline stage: the command name, or the kind of
+** compound command.
+*/
+const char	*exec_node_name(t_ast_node *node)
+{
+	if (node->type == NODE_COMMAND && node->data.cmd.argv
+		&& node->data.cmd.argv[0])
+		return (node->data.cmd.argv[0]);
+	if (node->type == NODE_SUBSHELL)
+		return ("subshell");
+	if (node->type == NODE_AND || node->type == NODE_OR)
+		return ("list");
+	return ("redirects");
+}
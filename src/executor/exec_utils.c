@@ -11,13 +11,18 @@
 /* ************************************************************************** */
 
 #include "../../includes/executor.h"
+#include "../../libft/libft.h"
 #include <stdlib.h>
+#include <unistd.h>
 
+/*
+** Zeroed first: every field not set here starts out as 0 or NULL.
+*/
 t_exec_ctx	*init_exec_ctx(char **environ)
 {
 	t_exec_ctx	*ctx;
 
-	ctx = (t_exec_ctx *)malloc(sizeof(t_exec_ctx));
+	ctx = (t_exec_ctx *)calloc(1, sizeof(t_exec_ctx));
 	if (!ctx)
 		return (NULL);
 	ctx->env = init_env(environ);
@@ -26,9 +31,15 @@ t_exec_ctx	*init_exec_ctx(char **environ)
 		free(ctx);
 		return (NULL);
 	}
-	ctx->last_status = 0;
 	ctx->stdin_backup = -1;
 	ctx->stdout_backup = -1;
+	sb_init(&ctx->expand_buf);
+	arena_init(&ctx->line_arena);
+	ctx->spawn_enabled = (env_get(ctx->env, "MINISHELL_NO_SPAWN") == NULL);
+	ctx->timing.fd = -1;
+	timing_init(&ctx->timing, env_get(ctx->env, "MINISHELL_TIMING"));
+	ctx->trace.fd = -1;
+	trace_init(&ctx->trace, env_get(ctx->env, "MINISHELL_TRACE"));
 	return (ctx);
 }
 
@@ -37,5 +48,67 @@ void	cleanup_exec_ctx(t_exec_ctx *ctx)
 	if (!ctx)
 		return ;
 	free_env(ctx->env);
+	free_envp(ctx->envp);
+	sb_free(&ctx->expand_buf);
+	arena_free(&ctx->line_arena);
+	timing_close(&ctx->timing);
+	trace_close(&ctx->trace);
+	cmd_hash_clear(ctx);
 	free(ctx);
 }
+
+/*
+** export and unset report every key they change here, for the settings
+** the executor caches.
+*/
+void	exec_env_changed(t_exec_ctx *ctx, char *key)
+{
+	cmd_hash_env_changed(ctx, key);
+	if (key && ft_strcmp(key, "MINISHELL_TIMING") == 0)
+		timing_init(&ctx->timing, env_get(ctx->env, key));
+	if (key && ft_strcmp(key, "MINISHELL_TRACE") == 0)
+		trace_init(&ctx->trace, env_get(ctx->env, key));
+}
+
+/*
+** A minishell run from a traced one would reopen the trace file, truncate
+** it and start a second array in it, so the setting is not passed on.
+** envp lists the variables in the order of the env list.
+*/
+static void	drop_trace_var(t_env *env, char **envp)
+{
+	t_env_var	*curr;
+	int			i;
+
+	curr = env->head;
+	i = 0;
+	while (curr && ft_strcmp(curr->key, "MINISHELL_TRACE") != 0)
+	{
+		curr = curr->next;
+		i++;
+	}
+	if (!curr)
+		return ;
+	free(envp[i]);
+	while (envp[i])
+	{
+		envp[i] = envp[i + 1];
+		i++;
+	}
+}
+
+char	**exec_envp(t_exec_ctx *ctx)
+{
+	char	**envp;
+
+	if (ctx->envp && !ctx->env->dirty)
+		return (ctx->envp);
+	envp = env_to_envp(ctx->env);
+	if (!envp)
+		return (NULL);
+	drop_trace_var(ctx->env, envp);
+	free_envp(ctx->envp);
+	ctx->envp = envp;
+	ctx->env->dirty = 0;
+	return (envp);
+}
@@ -15,7 +15,8 @@
 
 int	execute_ast(t_ast_node *ast, t_exec_ctx *ctx)
 {
-	int	status;
+	long long	start;
+	int			status;
 
 	if (!ast)
 		return (0);
@@ -23,7 +24,11 @@ int	execute_ast(t_ast_node *ast, t_exec_ctx *ctx)
 	if (ast->type == NODE_COMMAND)
 		status = exec_command(&ast->data.cmd, ctx);
 	else if (ast->type == NODE_PIPE)
-		status = exec_pipe(&ast->data.binop, ctx);
+	{
+		start = exec_clock(ctx);
+		status = exec_pipe(&ast->data.pipeline, ctx);
+		trace_event(&ctx->trace, "pipeline", start, status);
+	}
 	else if (ast->type == NODE_AND)
 		status = exec_and(&ast->data.binop, ctx);
 	else if (ast->type == NODE_OR)
@@ -18,119 +18,103 @@
 #include <unistd.h>
 #include <stdlib.h>
 
-static int	write_to_pipe(int fd, char *content)
+/*
+** Without the script reader, lines come from stdin through getline, into
+** one buffer reused for the whole body. The "> " prompt is only written
+** when stdin is a terminal.
+*/
+static char	*heredoc_getline(t_heredoc_io *io)
 {
-	size_t	len;
+	ssize_t	len;
 
-	if (!content)
-		return (0);
-	len = ft_strlen(content);
-	if (write(fd, content, len) == -1)
-		return (-1);
-	if (write(fd, "\n", 1) == -1)
-		return (-1);
-	return (0);
-}
-
-static char	*read_heredoc_line(void)
-{
-	char	*line;
-	size_t	len;
-
-	line = NULL;
-	len = 0;
-	write(STDOUT_FILENO, "> ", 2);
-	if (getline(&line, &len, stdin) == -1)
-	{
-		if (line)
-			free(line);
-		return (NULL);
-	}
-	if (g_sigint_received)
-	{
-		free(line);
+	if (io->prompt)
+		write(STDOUT_FILENO, "> ", 2);
+	len = getline(&io->line, &io->cap, stdin);
+	if (len == -1 || g_sigint_received)
 		return (NULL);
-	}
-	len = ft_strlen(line);
-	if (len > 0 && line[len - 1] == '\n')
-		line[len - 1] = '\0';
-	return (line);
+	if (len > 0 && io->line[len - 1] == '\n')
+		io->line[len - 1] = '\0';
+	return (io->line);
 }
 
-static int	is_delimiter(char *line, char *delim)
+/*
+** Script lines are used in place in the reader's buffer: each one is
+** copied into io->out before the next is read.
+*/
+static char	*next_heredoc_line(t_heredoc_io *io, t_exec_ctx *ctx)
 {
-	if (!line)
-		return (0);
-	return (ft_strcmp(line, delim) == 0);
+	if (ctx->reader)
+		return (reader_next_line(ctx->reader));
+	return (heredoc_getline(io));
 }
 
-static int	read_heredoc_content(int write_fd, char *delim, t_exec_ctx *ctx)
+/*
+** The body is spooled as typed. expand is set when it has to go through
+** expand_heredocs before its command runs.
+*/
+static int	read_heredoc_content(t_heredoc_io *io, t_redirect *redir,
+				t_exec_ctx *ctx)
 {
 	char	*line;
-	char	*expanded;
+	int		ret;
 
 	heredoc_signals();
-	while (1)
+	ret = 0;
+	while (ret == 0)
 	{
-		line = read_heredoc_line();
-		if (g_sigint_received || !line)
+		line = next_heredoc_line(io, ctx);
+		if (g_sigint_received || !line || ft_strcmp(line, redir->file) == 0)
 		{
-			if (line)
-				free(line);
-			init_signals();
 			if (g_sigint_received)
-				return (-1);
-			break ;
-		}
-		if (is_delimiter(line, delim))
-		{
-			free(line);
+				ret = -1;
 			break ;
 		}
-		expanded = expand_variables(line, ctx);
-		free(line);
-		if (write_to_pipe(write_fd, expanded) == -1)
-		{
-			free(expanded);
-			init_signals();
-			return (-1);
-		}
-		free(expanded);
+		if (!redir->quoted && !redir->expand && ft_strchr(line, '$'))
+			redir->expand = 1;
+		ret = heredoc_append(io, line, 0, ctx);
 	}
+	if (ret == 0)
+		ret = heredoc_flush(io, 0);
 	init_signals();
-	return (0);
+	return (ret);
 }
 
 int	process_heredoc(t_redirect *redir, t_exec_ctx *ctx)
 {
-	int	pipefd[2];
+	t_heredoc_io	io;
+	int				ret;
 
-	if (pipe(pipefd) == -1)
+	io.fd = heredoc_spool();
+	if (io.fd == -1)
 		return (-1);
-	if (read_heredoc_content(pipefd[1], redir->file, ctx) == -1)
-	{
-		close(pipefd[0]);
-		close(pipefd[1]);
-		return (-1);
-	}
-	close(pipefd[1]);
-	redir->heredoc_fd = pipefd[0];
-	return (0);
+	sb_init(&io.out);
+	io.line = NULL;
+	io.cap = 0;
+	io.prompt = isatty(STDIN_FILENO);
+	ret = read_heredoc_content(&io, redir, ctx);
+	if (ret == 0 && lseek(io.fd, 0, SEEK_SET) == -1)
+		ret = -1;
+	sb_free(&io.out);
+	free(io.line);
+	if (ret == -1)
+		close(io.fd);
+	else
+		redir->heredoc_fd = io.fd;
+	return (ret);
 }
 
 int	process_all_heredocs(t_redirect *redir, t_exec_ctx *ctx)
 {
 	t_redirect	*curr;
+	int			ret;
 
+	ret = 0;
 	curr = redir;
-	while (curr)
+	while (curr && ret == 0)
 	{
 		if (curr->type == REDIR_HEREDOC)
-		{
-			if (process_heredoc(curr, ctx) == -1)
-				return (-1);
-		}
+			ret = process_heredoc(curr, ctx);
 		curr = curr->next;
 	}
-	return (0);
+	return (ret);
 }
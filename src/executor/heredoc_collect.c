@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_collect.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+
+static int	walk_redirects(t_ast_node *node, t_redir_fn fn, t_exec_ctx *ctx);
+
+static int	walk_pipeline(t_pipeline_node *pipeline, t_redir_fn fn,
+				t_exec_ctx *ctx)
+{
+	int	ret;
+	int	i;
+
+	ret = 0;
+	i = 0;
+	while (ret == 0 && i < pipeline->count)
+		ret = walk_redirects(pipeline->stages[i++], fn, ctx);
+	return (ret);
+}
+
+/*
+** Call fn on every redirect list of the tree in source order: a
+** subshell's own redirects follow the commands inside it.
+*/
+static int	walk_redirects(t_ast_node *node, t_redir_fn fn, t_exec_ctx *ctx)
+{
+	if (!node)
+		return (0);
+	if (node->type == NODE_COMMAND)
+		return (fn(node->data.cmd.redirects, ctx));
+	if (node->type == NODE_PIPE)
+		return (walk_pipeline(&node->data.pipeline, fn, ctx));
+	if (node->type == NODE_SUBSHELL)
+	{
+		if (walk_redirects(node->data.subshell.child, fn, ctx) == -1)
+			return (-1);
+		return (fn(node->data.subshell.redirects, ctx));
+	}
+	if (walk_redirects(node->data.binop.left, fn, ctx) == -1)
+		return (-1);
+	return (walk_redirects(node->data.binop.right, fn, ctx));
+}
+
+static int	close_redirects(t_redirect *redir, t_exec_ctx *ctx)
+{
+	(void)ctx;
+	close_heredoc_fds(redir);
+	return (0);
+}
+
+/*
+** Read every heredoc of the line before anything runs, like bash does.
+** Execution then never waits on input halfway through, pipeline stages
+** are forked back to back, and in script mode the bodies are taken from
+** the shell's own reader rather than from a forked copy of it.
+*/
+int	collect_heredocs(t_ast_node *ast, t_exec_ctx *ctx)
+{
+	long long	start;
+	int			ret;
+
+	start = exec_clock(ctx);
+	ret = walk_redirects(ast, process_all_heredocs, ctx);
+	timing_add(&ctx->timing, PHASE_HEREDOC, start);
+	trace_event(&ctx->trace, "heredocs", start, ret);
+	return (ret);
+}
+
+/*
+** The line owns the heredoc files: a command that ran has only dup'ed
+** its own, and one that was skipped (&&, ||) never touched them.
+*/
+void	close_all_heredocs(t_ast_node *ast, t_exec_ctx *ctx)
+{
+	walk_redirects(ast, close_redirects, ctx);
+}
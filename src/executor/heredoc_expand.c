@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_expand.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../includes/expander.h"
+#include "../../libft/libft.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+/*
+** Batch one line of a body. With expand set, a line that contains a '$'
+** goes through the expander; every other line is copied as it is.
+*/
+int	heredoc_append(t_heredoc_io *io, char *line, int expand,
+		t_exec_ctx *ctx)
+{
+	char	*out;
+	int		ok;
+
+	out = line;
+	if (expand && ft_strchr(line, '$'))
+		out = expand_variables(line, ctx);
+	if (!out)
+		return (-1);
+	ok = sb_append_str(&io->out, out) && sb_append_char(&io->out, '\n');
+	if (out != line)
+		free(out);
+	if (!ok)
+		return (-1);
+	return (heredoc_flush(io, HEREDOC_FLUSH_SIZE));
+}
+
+static int	copy_expanded(int src, t_heredoc_io *io, t_exec_ctx *ctx)
+{
+	t_reader	r;
+	char		*line;
+	int			ret;
+
+	if (!reader_open(&r, src))
+	{
+		reader_close(&r);
+		return (-1);
+	}
+	ret = 0;
+	line = reader_next_line(&r);
+	while (ret == 0 && line)
+	{
+		ret = heredoc_append(io, line, 1, ctx);
+		line = reader_next_line(&r);
+	}
+	reader_close(&r);
+	if (ret == 0)
+		ret = heredoc_flush(io, 0);
+	return (ret);
+}
+
+/*
+** Rewrite the spooled body into a new spool file with its variables
+** expanded, and hand that one over instead. On failure neither spool is
+** usable (the old one has been read from, the new one is partial), so
+** the redirect is left without a body.
+*/
+static int	expand_heredoc(t_redirect *redir, t_exec_ctx *ctx)
+{
+	t_heredoc_io	io;
+	int				ret;
+
+	io.fd = heredoc_spool();
+	if (io.fd == -1)
+		return (-1);
+	sb_init(&io.out);
+	ret = copy_expanded(redir->heredoc_fd, &io, ctx);
+	sb_free(&io.out);
+	if (ret == 0 && lseek(io.fd, 0, SEEK_SET) == -1)
+		ret = -1;
+	close(redir->heredoc_fd);
+	redir->heredoc_fd = -1;
+	redir->expand = 0;
+	if (ret == -1)
+		close(io.fd);
+	else
+		redir->heredoc_fd = io.fd;
+	return (ret);
+}
+
+/*
+** Bodies are read before the line runs (collect_heredocs) but expanded
+** only when their command is about to run, like in bash: in
+** `export X=1 && cat <<EOF`, $X in the body is already 1.
+*/
+int	expand_heredocs(t_redirect *redir, t_exec_ctx *ctx)
+{
+	while (redir)
+	{
+		if (redir->type == REDIR_HEREDOC && redir->expand
+			&& expand_heredoc(redir, ctx) == -1)
+			return (-1);
+		redir = redir->next;
+	}
+	return (0);
+}
+
+void	close_heredoc_fds(t_redirect *redir)
+{
+	while (redir)
+	{
+		if (redir->type == REDIR_HEREDOC && redir->heredoc_fd != -1)
+		{
+			close(redir->heredoc_fd);
+			redir->heredoc_fd = -1;
+		}
+		redir = redir->next;
+	}
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_spool.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../libft/libft.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*
+** Where memfd_create exists, O_TMPFILE does too; both keep the body in
+** an unnamed file.
+*/
+#ifdef MFD_CLOEXEC
+
+static int	spool_anonymous(void)
+{
+	int	fd;
+
+	fd = memfd_create("minishell-heredoc", MFD_CLOEXEC);
+	if (fd == -1)
+		fd = open(HEREDOC_TMPDIR, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
+#else
+
+static int	spool_anonymous(void)
+{
+	return (-1);
+}
+#endif
+
+static int	spool_unlinked(void)
+{
+	char	path[sizeof(HEREDOC_TEMPLATE)];
+	int		fd;
+
+	ft_memcpy(path, HEREDOC_TEMPLATE, sizeof(path));
+	fd = mkstemp(path);
+	if (fd == -1)
+		return (-1);
+	unlink(path);
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	return (fd);
+}
+
+/*
+** A heredoc body is written in full before the command that reads it
+** starts, so it goes to an anonymous file rather than a pipe, whose
+** buffer (64 KiB on Linux) would block the shell on a larger body.
+** memfd_create keeps it in memory; without it, an O_TMPFILE or unlinked
+** mkstemp file in HEREDOC_TMPDIR is used. The caller rewinds the file
+** and hands it over as heredoc_fd.
+*/
+int	heredoc_spool(void)
+{
+	int	fd;
+
+	fd = spool_anonymous();
+	if (fd == -1)
+		fd = spool_unlinked();
+	if (fd == -1)
+		perror("minishell: heredoc");
+	return (fd);
+}
+
+/*
+** Write out the batched body once it holds at least min bytes; 0
+** flushes whatever is left.
+*/
+int	heredoc_flush(t_heredoc_io *io, size_t min)
+{
+	size_t	done;
+	ssize_t	n;
+
+	if (io->out.len == 0 || io->out.len < min)
+		return (0);
+	done = 0;
+	while (done < io->out.len)
+	{
+		n = write(io->fd, io->out.data + done, io->out.len - done);
+		if (n == -1)
+			return (-1);
+		done += n;
+	}
+	sb_reset(&io->out);
+	return (0);
+}
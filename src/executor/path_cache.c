@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+#include "../../libft/libft.h"
+#include <stdlib.h>
+
+char	*resolve_cached(char *command, t_exec_ctx *ctx)
+{
+	t_hash_entry	*entry;
+	char			*path;
+
+	if (ft_strchr(command, '/'))
+		return (resolve_path(command, ctx->env));
+	entry = cmd_hash_find(ctx, command);
+	if (entry)
+	{
+		entry->hits++;
+		return (ft_strdup(entry->path));
+	}
+	path = resolve_path(command, ctx->env);
+	if (!path)
+		return (NULL);
+	entry = cmd_hash_add(ctx, command, path);
+	if (entry)
+		entry->hits++;
+	return (path);
+}
@@ -11,25 +11,62 @@
 /* ************************************************************************** */
 
 #include "../../includes/expander.h"
-#include <stdlib.h>
+#include "../../includes/lexer.h"
 
-void	expand_tokens(t_token *tokens, t_exec_ctx *ctx)
+/*
+** Words that expansion leaves unchanged are used straight from the
+** input line: when the byte after the slice is blank (or the end of
+** the line) it is overwritten with a NUL, so no copy is made at all.
+*/
+static char	*materialize_word(t_token *tok, t_exec_ctx *ctx, t_arena *arena)
 {
-	t_token	*curr;
 	char	*expanded;
 
+	if (needs_expansion(tok->start, tok->len))
+	{
+		expanded = remove_quotes(tok->start, tok->len, ctx);
+		if (!expanded)
+			return (NULL);
+		return (arena_strndup(arena, expanded, ctx->expand_buf.len));
+	}
+	if (tok->start[tok->len] == '\0' || is_whitespace(tok->start[tok->len]))
+	{
+		tok->start[tok->len] = '\0';
+		return (tok->start);
+	}
+	return (arena_strndup(arena, tok->start, tok->len));
+}
+
+/*
+** A heredoc delimiter only loses its quotes; variables in it are not
+** expanded.
+*/
+static char	*materialize_delimiter(t_token *tok, t_exec_ctx *ctx,
+				t_arena *arena)
+{
+	if (!strip_quotes(tok->start, tok->len, ctx))
+		return (NULL);
+	return (arena_strndup(arena, ctx->expand_buf.data, ctx->expand_buf.len));
+}
+
+void	expand_tokens(t_token *tokens, t_exec_ctx *ctx, t_arena *arena)
+{
+	t_token			*curr;
+	t_token_type	prev;
+
+	prev = TOKEN_EOF;
 	curr = tokens;
 	while (curr)
 	{
-		if (curr->type == TOKEN_WORD && curr->value)
-		{
-			expanded = remove_quotes(curr->value, ctx);
-			if (expanded)
-			{
-				free(curr->value);
-				curr->value = expanded;
-			}
-		}
+		if (curr->type == TOKEN_WORD && !curr->value
+			&& prev == TOKEN_REDIR_HEREDOC)
+			curr->value = materialize_delimiter(curr, ctx, arena);
+		else if (curr->type == TOKEN_WORD && !curr->value)
+			curr->value = materialize_word(curr, ctx, arena);
+		if (curr->value && curr->type == TOKEN_WORD
+			&& prev >= TOKEN_REDIR_IN && prev <= TOKEN_REDIR_APPEND)
+			glob_unmark(curr->value);
+		prev = curr->type;
 		curr = curr->next;
 	}
 }
@@ -12,74 +12,88 @@
 
 #include "../../includes/expander.h"
 #include "../../libft/libft.h"
-#include <stdlib.h>
 
-char	*append_str(char *result, char *add)
+void	append_status(t_strbuf *sb, int status)
 {
-	char	*new;
+	char	digits[12];
+	int		i;
 
-	if (!add)
-		return (result);
-	if (!result)
-		return (ft_strdup(add));
-	new = ft_strjoin(result, add);
-	free(result);
-	return (new);
+	i = 12;
+	digits[--i] = (status % 10) + '0';
+	status /= 10;
+	while (status > 0)
+	{
+		digits[--i] = (status % 10) + '0';
+		status /= 10;
+	}
+	sb_append_n(sb, digits + i, 12 - i);
 }
 
-char	*append_char(char *result, char c)
+size_t	var_name_len(char *str, size_t max)
 {
-	char	temp[2];
-	char	*new;
+	size_t	i;
 
-	temp[0] = c;
-	temp[1] = '\0';
-	if (!result)
-		return (ft_strdup(temp));
-	new = ft_strjoin(result, temp);
-	free(result);
-	return (new);
+	i = 0;
+	while (i < max && (ft_isalnum(str[i]) || str[i] == '_'))
+		i++;
+	return (i);
 }
 
-char	*append_result(char *result, char *add)
+int	needs_expansion(char *str, size_t len)
 {
-	char	*new;
+	size_t	i;
 
-	if (!add)
-		return (result);
-	if (!result)
-		return (add);
-	new = ft_strjoin(result, add);
-	free(result);
-	free(add);
-	return (new);
+	i = 0;
+	while (i < len)
+	{
+		if (str[i] == '$' || str[i] == '\'' || str[i] == '"')
+			return (1);
+		i++;
+	}
+	return (0);
 }
 
-char	*extract_substring(char *str, int start, int end)
+/*
+** Put GLOB_QUOTED before each glob metacharacter appended to sb since
+** from, moving the tail back in one pass.
+*/
+void	glob_mark_quoted(t_strbuf *sb, size_t from)
 {
-	char	*result;
-	int		len;
+	size_t	marks;
+	size_t	i;
+	size_t	j;
 
-	len = end - start;
-	result = (char *)malloc(len + 1);
-	if (!result)
-		return (NULL);
-	len = 0;
-	while (start + len < end)
+	marks = 0;
+	i = from;
+	while (i < sb->len)
+		marks += (ft_strchr("*?[]", sb->data[i++]) != NULL);
+	if (marks == 0 || !sb_reserve(sb, marks))
+		return ;
+	i = sb->len;
+	j = sb->len + marks;
+	sb->len = j;
+	sb->data[j] = '\0';
+	while (i > from)
 	{
-		result[len] = str[start + len];
-		len++;
+		sb->data[--j] = sb->data[--i];
+		if (ft_strchr("*?[]", sb->data[i]))
+			sb->data[--j] = GLOB_QUOTED;
 	}
-	result[len] = '\0';
-	return (result);
 }
 
-char	*get_unquoted_segment(char *str, int *i)
+char	*glob_unmark(char *word)
 {
-	int	start;
+	size_t	i;
+	size_t	j;
 
-	start = *i;
-	while (str[*i] && str[*i] != '\'' && str[*i] != '"')
-		(*i)++;
-	return (extract_substring(str, start, *i));
+	i = 0;
+	j = 0;
+	while (word[i])
+	{
+		if (word[i] == GLOB_QUOTED && word[i + 1])
+			i++;
+		word[j++] = word[i++];
+	}
+	word[j] = '\0';
+	return (word);
 }
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_compile.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+#include "../../libft/libft.h"
+
+static void	class_fill(t_glob_elem *e, char *p, int start, int end)
+{
+	int				j;
+	unsigned int	c;
+
+	j = start;
+	while (j < end)
+	{
+		c = (unsigned char)p[j];
+		if (p[j + 1] == '-' && j + 2 < end)
+		{
+			while (c <= (unsigned char)p[j + 2])
+			{
+				e->set[c >> 3] |= (1 << (c & 7));
+				c++;
+			}
+			j += 3;
+			continue ;
+		}
+		e->set[c >> 3] |= (1 << (c & 7));
+		j++;
+	}
+}
+
+static int	compile_class(t_glob_elem *e, char *p)
+{
+	int	negate;
+	int	start;
+	int	end;
+	int	i;
+
+	negate = (p[1] == '!' || p[1] == '^');
+	start = 1 + negate;
+	end = start;
+	if (p[end] == ']')
+		end++;
+	while (p[end] && p[end] != ']' && p[end] != GLOB_QUOTED)
+		end++;
+	if (p[end] != ']')
+		return (0);
+	i = 0;
+	while (i < 32)
+		e->set[i++] = 0;
+	class_fill(e, p, start, end);
+	while (negate && i-- > 0)
+		e->set[i] = ~e->set[i];
+	return (end + 1);
+}
+
+static int	compile_elem(t_glob *g, char *p)
+{
+	t_glob_elem	*e;
+	int			used;
+
+	if (*p == '*' && g->count > 0 && g->elems[g->count - 1].kind == GLOB_STAR)
+		return (1);
+	e = &g->elems[g->count++];
+	e->kind = GLOB_LITERAL;
+	e->ch = (unsigned char)*p;
+	used = 1;
+	if (*p == GLOB_QUOTED && p[1])
+		e->ch = (unsigned char)p[used++];
+	else if (*p == '*')
+		e->kind = GLOB_STAR;
+	else if (*p == '?')
+		e->kind = GLOB_ANY;
+	else if (*p == '[')
+	{
+		used = compile_class(e, p);
+		if (used)
+			e->kind = GLOB_CLASS;
+		else
+			used = 1;
+	}
+	return (used);
+}
+
+int	glob_compile(t_glob *g, char *pattern)
+{
+	int	i;
+
+	g->elems = (t_glob_elem *)malloc(sizeof(t_glob_elem)
+			* (ft_strlen(pattern) + 1));
+	if (!g->elems)
+		return (0);
+	g->count = 0;
+	i = 0;
+	while (pattern[i])
+		i += compile_elem(g, pattern + i);
+	return (1);
+}
+
+void	glob_free(t_glob *g)
+{
+	free(g->elems);
+	g->elems = NULL;
+	g->count = 0;
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+static int	elem_matches(t_glob_elem *e, unsigned char c)
+{
+	if (e->kind == GLOB_ANY)
+		return (1);
+	if (e->kind == GLOB_CLASS)
+		return ((e->set[c >> 3] >> (c & 7)) & 1);
+	return (e->ch == c);
+}
+
+/*
+** Two-pointer matcher over st = {pattern, string, star, mark}: on a
+** mismatch only the most recent star is retried, one character further
+** along. Earlier stars never need revisiting, so a match costs at most
+** O(len(str) * count) instead of the exponential recursive search.
+*/
+static int	glob_step(t_glob *g, char *str, int *st)
+{
+	if (st[0] < g->count && g->elems[st[0]].kind == GLOB_STAR)
+	{
+		st[2] = st[0]++;
+		st[3] = st[1];
+	}
+	else if (st[0] < g->count
+		&& elem_matches(&g->elems[st[0]], (unsigned char)str[st[1]]))
+	{
+		st[0]++;
+		st[1]++;
+	}
+	else if (st[2] == -1)
+		return (0);
+	else
+	{
+		st[0] = st[2] + 1;
+		st[1] = ++st[3];
+	}
+	return (1);
+}
+
+int	glob_match(t_glob *g, char *str)
+{
+	int	st[4];
+
+	st[0] = 0;
+	st[1] = 0;
+	st[2] = -1;
+	st[3] = 0;
+	while (str[st[1]])
+	{
+		if (!glob_step(g, str, st))
+			return (0);
+	}
+	while (st[0] < g->count && g->elems[st[0]].kind == GLOB_STAR)
+		st[0]++;
+	return (st[0] == g->count);
+}
+
+int	is_glob_pattern(char *word)
+{
+	int	i;
+	int	open;
+
+	i = 0;
+	open = 0;
+	while (word[i])
+	{
+		if (word[i] == GLOB_QUOTED && word[i + 1])
+			i++;
+		else if (word[i] == '*' || word[i] == '?')
+			return (1);
+		if (word[i] == '[')
+			open = 1;
+		else if (word[i] == ']' && open)
+			return (1);
+		i++;
+	}
+	return (0);
+}
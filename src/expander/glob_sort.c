@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_sort.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+#include "../../libft/libft.h"
+
+static void	insertion_sort(char **items, int count)
+{
+	int		i;
+	int		j;
+	char	*key;
+
+	i = 1;
+	while (i < count)
+	{
+		key = items[i];
+		j = i - 1;
+		while (j >= 0 && ft_strcmp(items[j], key) > 0)
+		{
+			items[j + 1] = items[j];
+			j--;
+		}
+		items[j + 1] = key;
+		i++;
+	}
+}
+
+static void	merge_halves(char **items, char **tmp, int half, int count)
+{
+	int	i;
+	int	j;
+	int	k;
+
+	ft_memcpy(tmp, items, half * sizeof(char *));
+	i = 0;
+	j = half;
+	k = 0;
+	while (i < half && j < count)
+	{
+		if (ft_strcmp(tmp[i], items[j]) <= 0)
+			items[k++] = tmp[i++];
+		else
+			items[k++] = items[j++];
+	}
+	while (i < half)
+		items[k++] = tmp[i++];
+}
+
+/*
+** Top-down merge sort; tmp holds at least count / 2 pointers and is
+** reused by every level, since only the left half is ever copied out.
+** Runs that are already in order skip the merge entirely.
+*/
+static void	merge_sort(char **items, char **tmp, int count)
+{
+	int	half;
+
+	if (count <= GLOB_SORT_CUTOFF)
+	{
+		insertion_sort(items, count);
+		return ;
+	}
+	half = count / 2;
+	merge_sort(items, tmp, half);
+	merge_sort(items + half, tmp, count - half);
+	if (ft_strcmp(items[half - 1], items[half]) > 0)
+		merge_halves(items, tmp, half, count);
+}
+
+/*
+** Byte-wise ordering, independent of the locale. Stable, so equal
+** names keep their directory order.
+*/
+int	sort_matches(char **matches, int count)
+{
+	char	**tmp;
+
+	if (count <= GLOB_SORT_CUTOFF)
+	{
+		insertion_sort(matches, count);
+		return (1);
+	}
+	tmp = (char **)malloc(sizeof(char *) * (count / 2));
+	if (!tmp)
+		return (0);
+	merge_sort(matches, tmp, count);
+	free(tmp);
+	return (1);
+}
@@ -12,86 +12,104 @@
 
 #include "../../includes/expander.h"
 #include "../../libft/libft.h"
-#include <stdlib.h>
 
-static char	*process_squote(char *str, int *i)
+static size_t	copy_squote(t_strbuf *sb, char *str, size_t len)
 {
-	char	*result;
-	int		start;
+	size_t	i;
+	size_t	from;
 
-	(*i)++;
-	start = *i;
-	while (str[*i] && str[*i] != '\'')
-		(*i)++;
-	result = extract_substring(str, start, *i);
-	if (str[*i] == '\'')
-		(*i)++;
-	return (result);
+	i = 1;
+	while (i < len && str[i] != '\'')
+		i++;
+	from = sb->len;
+	sb_append_n(sb, str + 1, i - 1);
+	glob_mark_quoted(sb, from);
+	if (i < len)
+		i++;
+	return (i);
 }
 
-static char	*process_dquote(char *str, int *i, t_exec_ctx *ctx)
+static size_t	expand_dquote(t_strbuf *sb, char *str, size_t len,
+					t_exec_ctx *ctx)
 {
-	char	*temp;
-	char	*result;
-	int		start;
+	size_t	i;
+	size_t	from;
 
-	(*i)++;
-	start = *i;
-	while (str[*i] && str[*i] != '"')
-		(*i)++;
-	temp = extract_substring(str, start, *i);
-	if (!temp)
-		return (NULL);
-	result = expand_variables(temp, ctx);
-	free(temp);
-	if (str[*i] == '"')
-		(*i)++;
-	return (result);
+	i = 1;
+	while (i < len && str[i] != '"')
+		i++;
+	from = sb->len;
+	expand_into(sb, str + 1, i - 1, ctx);
+	glob_mark_quoted(sb, from);
+	if (i < len)
+		i++;
+	return (i);
 }
 
-static char	*process_unquoted(char *str, int *i, t_exec_ctx *ctx)
+static size_t	expand_unquoted(t_strbuf *sb, char *str, size_t len,
+					t_exec_ctx *ctx)
 {
-	char	*temp;
-	char	*expanded;
+	size_t	i;
 
-	temp = get_unquoted_segment(str, i);
-	expanded = expand_variables(temp, ctx);
-	free(temp);
-	return (expanded);
+	i = 0;
+	while (i < len && str[i] != '\'' && str[i] != '"')
+		i++;
+	expand_into(sb, str, i, ctx);
+	return (i);
 }
 
-static char	*process_segment(char *str, int *i, char **r, t_exec_ctx *ctx)
+/*
+** Expands the first len bytes of str. The result lives in
+** ctx->expand_buf and is overwritten by the next expansion; callers
+** copy what they keep.
+*/
+char	*remove_quotes(char *str, size_t len, t_exec_ctx *ctx)
 {
-	char	*temp;
+	t_strbuf	*sb;
+	size_t		i;
 
-	if (str[*i] == '\'')
-	{
-		temp = process_squote(str, i);
-		*r = append_result(*r, temp);
-	}
-	else if (str[*i] == '"')
-	{
-		temp = process_dquote(str, i, ctx);
-		*r = append_result(*r, temp);
-	}
-	else
+	sb = &ctx->expand_buf;
+	sb_reset(sb);
+	if (!sb_reserve(sb, len))
+		return (NULL);
+	i = 0;
+	while (i < len)
 	{
-		temp = process_unquoted(str, i, ctx);
-		*r = append_result(*r, temp);
+		if (str[i] == '\'')
+			i += copy_squote(sb, str + i, len - i);
+		else if (str[i] == '"')
+			i += expand_dquote(sb, str + i, len - i, ctx);
+		else
+			i += expand_unquoted(sb, str + i, len - i, ctx);
 	}
-	return (*r);
+	return (sb->data);
 }
 
-char	*remove_quotes(char *str, t_exec_ctx *ctx)
+/*
+** Quote removal without expansion, for heredoc delimiters: in <<"$X"
+** the delimiter is the literal $X. Same buffer contract as remove_quotes.
+*/
+char	*strip_quotes(char *str, size_t len, t_exec_ctx *ctx)
 {
-	char	*result;
-	int		i;
+	t_strbuf	*sb;
+	size_t		i;
+	char		quote;
 
-	result = NULL;
+	sb = &ctx->expand_buf;
+	sb_reset(sb);
+	if (!sb_reserve(sb, len))
+		return (NULL);
+	quote = 0;
 	i = 0;
-	while (str[i])
-		process_segment(str, &i, &result, ctx);
-	if (!result)
-		return (ft_strdup(""));
-	return (result);
+	while (i < len)
+	{
+		if (str[i] == quote)
+			quote = 0;
+		else if (!quote && (str[i] == '\'' || str[i] == '"'))
+			quote = str[i];
+		else
+			sb_append_n(sb, str + i, 1);
+		i++;
+	}
+	return (sb->data);
 }
@@ -12,113 +12,56 @@
 
 #include "../../includes/expander.h"
 #include "../../libft/libft.h"
-#include <stdlib.h>
 
-static char	*get_var_name(char *str, int *len)
-{
-	int		i;
-	char	*name;
-
-	i = 0;
-	while (str[i] && (ft_isalnum(str[i]) || str[i] == '_'))
-		i++;
-	*len = i;
-	name = (char *)malloc(i + 1);
-	if (!name)
-		return (NULL);
-	i = 0;
-	while (str[i] && (ft_isalnum(str[i]) || str[i] == '_'))
-	{
-		name[i] = str[i];
-		i++;
-	}
-	name[i] = '\0';
-	return (name);
-}
-
-static char	*get_var_value(char *name, t_exec_ctx *ctx)
+static size_t	expand_dollar(t_strbuf *sb, char *str, size_t len,
+					t_exec_ctx *ctx)
 {
 	char	*value;
+	size_t	name_len;
 
-	if (!name || !name[0])
-		return (ft_strdup(""));
-	value = env_get(ctx->env, name);
-	if (!value)
-		return (ft_strdup(""));
-	return (ft_strdup(value));
-}
-
-static char	*expand_status(t_exec_ctx *ctx)
-{
-	char	*status_str;
-	int		status;
-	int		len;
-	int		temp;
-
-	status = ctx->last_status;
-	temp = status;
-	len = 1;
-	while (temp >= 10)
+	if (str[1] == '?')
 	{
-		temp /= 10;
-		len++;
-	}
-	status_str = (char *)malloc(len + 1);
-	if (!status_str)
-		return (NULL);
-	status_str[len] = '\0';
-	while (len > 0)
-	{
-		status_str[--len] = (status % 10) + '0';
-		status /= 10;
-	}
-	return (status_str);
-}
-
-static int	process_dollar(char *str, int i, char **r, t_exec_ctx *ctx)
-{
-	char	*var_name;
-	char	*var_value;
-	int		var_len;
-
-	if (str[i + 1] == '?')
-	{
-		var_value = expand_status(ctx);
-		*r = append_str(*r, var_value);
-		free(var_value);
+		append_status(sb, ctx->last_status);
 		return (2);
 	}
-	else if (ft_isalpha(str[i + 1]) || str[i + 1] == '_')
+	if (ft_isalpha(str[1]) || str[1] == '_')
 	{
-		var_name = get_var_name(&str[i + 1], &var_len);
-		var_value = get_var_value(var_name, ctx);
-		*r = append_str(*r, var_value);
-		free(var_name);
-		free(var_value);
-		return (var_len + 1);
+		name_len = var_name_len(str + 1, len - 1);
+		value = env_get_n(ctx->env, str + 1, name_len);
+		if (value)
+			sb_append_str(sb, value);
+		return (name_len + 1);
 	}
-	*r = append_str(*r, "$");
+	sb_append_char(sb, '$');
 	return (1);
 }
 
-char	*expand_variables(char *str, t_exec_ctx *ctx)
+void	expand_into(t_strbuf *sb, char *str, size_t len, t_exec_ctx *ctx)
 {
-	char	*result;
-	int		i;
+	size_t	i;
+	size_t	run;
 
-	result = NULL;
 	i = 0;
-	while (str[i])
+	while (i < len)
 	{
-		if (str[i] == '$' && str[i + 1])
-			i += process_dollar(str, i, &result, ctx);
-		else
+		run = 0;
+		while (i + run < len && str[i + run] != '$')
+			run++;
+		sb_append_n(sb, str + i, run);
+		i += run;
+		if (i + 1 < len)
+			i += expand_dollar(sb, str + i, len - i, ctx);
+		else if (i < len)
 		{
-			result = append_char(result, str[i]);
+			sb_append_char(sb, '$');
 			i++;
 		}
 	}
-	if (!result)
-		return (ft_strdup(""));
-	return (result);
+}
+
+char	*expand_variables(char *str, t_exec_ctx *ctx)
+{
+	sb_reset(&ctx->expand_buf);
+	expand_into(&ctx->expand_buf, str, ft_strlen(str), ctx);
+	return (sb_dup(&ctx->expand_buf));
 }
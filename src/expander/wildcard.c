@@ -15,90 +15,67 @@
 #include <dirent.h>
 #include <stdlib.h>
 
-static int	match_pattern(char *str, char *pattern)
-{
-	if (!*pattern)
-		return (!*str);
-	if (*pattern == '*')
-	{
-		if (match_pattern(str, pattern + 1))
-			return (1);
-		if (*str && match_pattern(str + 1, pattern))
-			return (1);
-		return (0);
-	}
-	if (*str == *pattern)
-		return (match_pattern(str + 1, pattern + 1));
-	return (0);
-}
-
-static int	should_match(char *filename, char *pattern)
-{
-	if (filename[0] == '.')
-		return (0);
-	return (match_pattern(filename, pattern));
-}
-
-static int	count_matches(char *pattern)
+static int	read_dir_names(t_strbuf *names)
 {
 	DIR				*dir;
 	struct dirent	*entry;
-	int				count;
 
-	count = 0;
 	dir = opendir(".");
 	if (!dir)
 		return (0);
 	entry = readdir(dir);
 	while (entry)
 	{
-		if (should_match(entry->d_name, pattern))
-			count++;
+		if (entry->d_name[0] != '.')
+		{
+			if (!sb_append_n(names, entry->d_name,
+					ft_strlen(entry->d_name) + 1))
+				return (closedir(dir), 0);
+		}
 		entry = readdir(dir);
 	}
 	closedir(dir);
-	return (count);
+	return (1);
 }
 
-static char	**collect_matches(char *pattern, int count)
+int	dirlist_load(t_dirlist *dir)
 {
-	char			**result;
-	DIR				*dir;
-	struct dirent	*entry;
-	int				i;
+	size_t	pos;
 
-	result = (char **)malloc(sizeof(char *) * (count + 1));
-	if (!result)
-		return (NULL);
-	dir = opendir(".");
-	if (!dir)
-		return (free(result), NULL);
-	i = 0;
-	entry = readdir(dir);
-	while (entry && i < count)
+	if (dir->loaded)
+		return (1);
+	dir->loaded = 1;
+	if (!read_dir_names(&dir->names))
+		return (0);
+	pos = 0;
+	while (pos < dir->names.len)
 	{
-		if (should_match(entry->d_name, pattern))
-			result[i++] = ft_strdup(entry->d_name);
-		entry = readdir(dir);
+		if (!sv_push(&dir->entries, dir->names.data + pos))
+			return (0);
+		pos += ft_strlen(dir->names.data + pos) + 1;
 	}
-	result[i] = NULL;
-	closedir(dir);
-	return (result);
+	return (1);
 }
 
-char	**expand_wildcard(char *pattern)
+int	expand_glob_word(t_dirlist *dir, char *pattern, t_strvec *out)
 {
-	char	**matches;
-	int		count;
+	t_glob	glob;
+	size_t	start;
+	size_t	i;
 
-	if (!pattern || !ft_strchr(pattern, '*'))
-		return (NULL);
-	count = count_matches(pattern);
-	if (count == 0)
-		return (NULL);
-	matches = collect_matches(pattern, count);
-	if (!matches)
-		return (NULL);
-	sort_matches(matches, count);
-	return (matches);
+	if (!dirlist_load(dir) || !glob_compile(&glob, pattern))
+		return (-1);
+	start = out->len;
+	i = 0;
+	while (i < dir->entries.len)
+	{
+		if (glob_match(&glob, dir->entries.items[i])
+			&& !sv_push_dup(out, dir->entries.items[i]))
+			return (glob_free(&glob), -1);
+		i++;
+	}
+	glob_free(&glob);
+	if (!sort_matches(out->items + start, out->len - start))
+		return (-1);
+	return (out->len - start);
 }
@@ -12,100 +12,64 @@
 
 #include "../../includes/expander.h"
 #include "../../libft/libft.h"
-#include <stdlib.h>
 
-void	sort_matches(char **matches, int count)
+static int	argv_has_glob(char **argv)
 {
-	int		i;
-	int		j;
-	char	*temp;
+	int	i;
 
 	i = 0;
-	while (i < count - 1)
+	while (argv[i])
 	{
-		j = i + 1;
-		while (j < count)
-		{
-			if (ft_strcmp(matches[i], matches[j]) > 0)
-			{
-				temp = matches[i];
-				matches[i] = matches[j];
-				matches[j] = temp;
-			}
-			j++;
-		}
+		if (is_glob_pattern(argv[i]) || ft_strchr(argv[i], GLOB_QUOTED))
+			return (1);
 		i++;
 	}
+	return (0);
 }
 
-int	count_expanded_args(char **argv)
+static void	dirlist_free(t_dirlist *dir)
 {
-	int		total;
-	int		i;
-	int		j;
-	char	**matches;
-
-	total = 0;
-	i = 0;
-	while (argv[i])
-	{
-		matches = expand_wildcard(argv[i]);
-		if (matches)
-		{
-			j = 0;
-			while (matches[j])
-			{
-				total++;
-				j++;
-			}
-			ft_free_split(matches);
-		}
-		else
-			total++;
-		i++;
-	}
-	return (total);
+	sv_free(&dir->entries, 0);
+	sb_free(&dir->names);
 }
 
-void	copy_matches(char **result, char **matches, int *idx)
+static int	expand_word(t_dirlist *dir, char *word, t_strvec *out)
 {
-	int	i;
+	int	matched;
 
-	i = 0;
-	while (matches[i])
-	{
-		result[*idx] = matches[i];
-		(*idx)++;
-		i++;
-	}
-	free(matches);
+	matched = 0;
+	if (is_glob_pattern(word))
+		matched = expand_glob_word(dir, word, out);
+	if (matched == -1)
+		return (0);
+	if (matched == 0)
+		return (sv_push_dup(out, glob_unmark(word)));
+	return (1);
 }
 
 char	**expand_argv_wildcards(char **argv)
 {
-	char	**result;
-	char	**matches;
-	int		total;
-	int		i;
-	int		j;
+	t_dirlist	dir;
+	t_strvec	out;
+	int			i;
 
-	if (!argv)
-		return (NULL);
-	total = count_expanded_args(argv);
-	result = (char **)malloc(sizeof(char *) * (total + 1));
-	if (!result)
+	if (!argv || !argv_has_glob(argv))
 		return (NULL);
+	sb_init(&dir.names);
+	sv_init(&dir.entries);
+	dir.loaded = 0;
+	sv_init(&out);
 	i = 0;
-	j = 0;
 	while (argv[i])
 	{
-		matches = expand_wildcard(argv[i]);
-		if (matches)
-			copy_matches(result, matches, &j);
-		else
-			result[j++] = ft_strdup(argv[i]);
+		if (!expand_word(&dir, argv[i], &out))
+		{
+			dirlist_free(&dir);
+			sv_free(&out, 1);
+			return (NULL);
+		}
 		i++;
 	}
-	result[j] = NULL;
-	return (result);
+	dirlist_free(&dir);
+	return (out.items);
 }
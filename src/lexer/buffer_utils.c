@@ -12,36 +12,11 @@
 
 #include "../../includes/minishell.h"
 
-char	*buffer_extract(t_lexer *lex, int start, int end)
-{
-	char	*str;
-	int		len;
-	int		i;
-
-	len = end - start;
-	str = (char *)malloc(sizeof(char) * (len + 1));
-	if (!str)
-		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		str[i] = lex->input[start + i];
-		i++;
-	}
-	str[i] = '\0';
-	return (str);
-}
-
 void	buffer_add_word_token(t_lexer *lex)
 {
-	char	*value;
 	t_token	*token;
 
-	value = buffer_extract(lex, lex->start, lex->pos);
-	if (!value)
-		return ;
-	token = token_create(TOKEN_WORD, value, lex->start);
-	free(value);
+	token = token_create(lex, TOKEN_WORD, lex->start, lex->pos - lex->start);
 	if (token)
 		token_append(lex, token);
 }
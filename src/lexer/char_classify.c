@@ -12,32 +12,43 @@
 
 #include "../../includes/minishell.h"
 
+/*
+** One lookup per byte instead of a chain of comparisons. Every byte not
+** named here is zero, i.e. CC_WORD, which includes all non-ASCII bytes.
+*/
+const unsigned char	*lexer_classes(void)
+{
+	static const unsigned char	classes[256] = {
+	['\0'] = CC_END, [' '] = CC_BLANK, ['\t'] = CC_BLANK,
+	['\n'] = CC_BLANK, ['\''] = CC_SQUOTE, ['"'] = CC_DQUOTE,
+	['|'] = CC_OPERATOR, ['<'] = CC_OPERATOR, ['>'] = CC_OPERATOR,
+	['&'] = CC_OPERATOR, ['('] = CC_OPERATOR, [')'] = CC_OPERATOR};
+
+	return (classes);
+}
+
 int	is_whitespace(char c)
 {
-	if (c == ' ' || c == '\t' || c == '\n')
-		return (1);
-	return (0);
+	return (lexer_classes()[(unsigned char)c] == CC_BLANK);
 }
 
 int	is_operator_char(char c)
 {
-	if (c == '|' || c == '<' || c == '>')
-		return (1);
-	if (c == '&' || c == '(' || c == ')')
-		return (1);
-	return (0);
+	return (lexer_classes()[(unsigned char)c] == CC_OPERATOR);
 }
 
 int	is_quote(char c)
 {
-	if (c == '\'' || c == '"')
-		return (1);
-	return (0);
+	unsigned char	cls;
+
+	cls = lexer_classes()[(unsigned char)c];
+	return (cls == CC_SQUOTE || cls == CC_DQUOTE);
 }
 
 int	is_special_char(char c)
 {
-	if (is_operator_char(c) || is_quote(c))
-		return (1);
-	return (0);
+	unsigned char	cls;
+
+	cls = lexer_classes()[(unsigned char)c];
+	return (cls == CC_OPERATOR || cls == CC_SQUOTE || cls == CC_DQUOTE);
 }
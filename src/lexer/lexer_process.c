@@ -12,29 +12,62 @@
 
 #include "../../includes/minishell.h"
 
-static void	dispatch_state(t_lexer *lex)
+/*
+** Consume a whole run of word bytes at once; the token is emitted at
+** the first blank, quote, operator or NUL.
+*/
+static void	scan_word(t_lexer *lex)
 {
-	if (lex->state == STATE_INITIAL)
-		handle_initial_state(lex);
-	else if (lex->state == STATE_WORD)
-		handle_word_state(lex);
-	else if (lex->state == STATE_SQUOTE)
-		handle_squote_state(lex);
-	else if (lex->state == STATE_DQUOTE)
-		handle_dquote_state(lex);
-	else if (lex->state == STATE_OPERATOR)
-		handle_operator_state(lex);
+	lex->pos = lex_span_word(lex->input, lex->pos);
+	buffer_add_word_token(lex);
+}
+
+/*
+** A quoted segment is one token including both quotes. An unclosed quote
+** consumes the rest of the line without producing a token.
+*/
+static void	scan_quoted(t_lexer *lex, char quote)
+{
+	lex->pos = lex_span_quote(lex->input, lex->pos + 1, quote);
+	if (lex->input[lex->pos] == '\0')
+		return ;
+	lex->pos++;
+	buffer_add_word_token(lex);
+}
+
+static int	skip_blanks(t_lexer *lex)
+{
+	const unsigned char	*classes;
+	const char			*input;
+	int					pos;
+
+	classes = lex->classes;
+	input = lex->input;
+	pos = lex->pos;
+	while (classes[(unsigned char)input[pos]] == CC_BLANK)
+		pos++;
+	lex->pos = pos;
+	return (classes[(unsigned char)input[pos]]);
 }
 
 void	lexer_process(t_lexer *lex)
 {
 	t_token	*eof_token;
+	int		cls;
 
-	while (lex->input[lex->pos] != '\0')
-		dispatch_state(lex);
-	if (lex->state == STATE_WORD)
-		buffer_add_word_token(lex);
-	eof_token = token_create(TOKEN_EOF, NULL, lex->pos);
+	cls = skip_blanks(lex);
+	while (cls != CC_END)
+	{
+		lex->start = lex->pos;
+		if (cls == CC_WORD)
+			scan_word(lex);
+		else if (cls == CC_OPERATOR)
+			lex_operator(lex);
+		else
+			scan_quoted(lex, lex->input[lex->pos]);
+		cls = skip_blanks(lex);
+	}
+	eof_token = token_create(lex, TOKEN_EOF, lex->pos, 0);
 	if (eof_token)
 		token_append(lex, eof_token);
 }
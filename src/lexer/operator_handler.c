@@ -14,21 +14,15 @@
 
 static void	add_operator_token(t_lexer *lex, t_token_type type, int len)
 {
-	char	*value;
 	t_token	*token;
 
-	value = buffer_extract(lex, lex->start, lex->start + len);
-	if (!value)
-		return ;
-	token = token_create(type, value, lex->start);
-	free(value);
+	token = token_create(lex, type, lex->start, len);
 	if (token)
 		token_append(lex, token);
 	lex->pos = lex->start + len;
-	lex->state = STATE_INITIAL;
 }
 
-void	handle_operator_state(t_lexer *lex)
+void	lex_operator(t_lexer *lex)
 {
 	t_token_type	type;
 
@@ -46,5 +40,4 @@ void	handle_operator_state(t_lexer *lex)
 	}
 	error_print("unknown operator");
 	lex->pos++;
-	lex->state = STATE_INITIAL;
 }
@@ -1,53 +1,37 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   quote_handlers.c                                   :+:      :+:    :+:   */
+/*   scan_scalar.c                                      :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2026/02/03 08:00:00 by tkeereweer       #+#    #+#             */
-/*   Updated: 2026/02/03 08:00:00 by tkeereweer      ###   ########.fr       */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/minishell.h"
 
-void	handle_squote_state(t_lexer *lex)
+#if LEXER_SCAN_WIDTH == 1
+
+/*
+** Portable span scanners, used when no vector unit is selected.
+*/
+int	lex_span_word(const char *input, int pos)
 {
-	char	c;
+	const unsigned char	*classes;
 
-	c = lex->input[lex->pos];
-	if (c == '\0')
-	{
-		error_print("unclosed single quote");
-		return ;
-	}
-	if (c == '\'')
-	{
-		lex->pos++;
-		buffer_add_word_token(lex);
-		lex->state = STATE_INITIAL;
-		return ;
-	}
-	lex->pos++;
+	classes = lexer_classes();
+	while (classes[(unsigned char)input[pos]] == CC_WORD)
+		pos++;
+	return (pos);
 }
 
-void	handle_dquote_state(t_lexer *lex)
+int	lex_span_quote(const char *input, int pos, char quote)
 {
-	char	c;
-
-	c = lex->input[lex->pos];
-	if (c == '\0')
-	{
-		error_print("unclosed double quote");
-		return ;
-	}
-	if (c == '\"')
-	{
-		lex->pos++;
-		buffer_add_word_token(lex);
-		lex->state = STATE_INITIAL;
-		return ;
-	}
-	lex->pos++;
+	while (input[pos] && input[pos] != quote)
+		pos++;
+	return (pos);
 }
+
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scan_sse2.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+#if LEXER_SCAN_WIDTH == 16
+# include <emmintrin.h>
+# include <stdint.h>
+
+/*
+** Bit i is set when byte i of the aligned block ends a word: NUL, a
+** blank, a quote or an operator character, as in lexer_classes().
+*/
+static unsigned int	word_stops(const char *block)
+{
+	__m128i	v;
+	__m128i	hit;
+
+	v = _mm_load_si128((const __m128i *)block);
+	hit = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('|')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('<')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('&')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8('(')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(')')));
+	return (_mm_movemask_epi8(hit));
+}
+
+static unsigned int	quote_stops(const char *block, char quote)
+{
+	__m128i	v;
+	__m128i	hit;
+
+	v = _mm_load_si128((const __m128i *)block);
+	hit = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(quote)));
+	return (_mm_movemask_epi8(hit));
+}
+
+/*
+** Both scanners read whole aligned 16-byte blocks, like libc's strlen:
+** an aligned block never crosses a page, so reading the bytes around
+** the string inside it cannot fault. Bits for bytes before pos are
+** shifted out of the first block.
+**
+** Most words are short, so the first 16 bytes go through the class
+** table and only longer runs reach the vector loop.
+*/
+int	lex_span_word(const char *input, int pos)
+{
+	const unsigned char	*classes;
+	const char			*block;
+	unsigned int		stops;
+	int					skip;
+	int					end;
+
+	classes = lexer_classes();
+	end = pos + 16;
+	while (pos < end && classes[(unsigned char)input[pos]] == CC_WORD)
+		pos++;
+	if (pos < end)
+		return (pos);
+	skip = (uintptr_t)(input + pos) & 15;
+	block = input + pos - skip;
+	stops = word_stops(block) >> skip << skip;
+	while (stops == 0)
+	{
+		block += 16;
+		stops = word_stops(block);
+	}
+	return (block - input + __builtin_ctz(stops));
+}
+
+int	lex_span_quote(const char *input, int pos, char quote)
+{
+	const char		*block;
+	unsigned int	stops;
+	int				skip;
+
+	skip = (uintptr_t)(input + pos) & 15;
+	block = input + pos - skip;
+	stops = quote_stops(block, quote) >> skip << skip;
+	while (stops == 0)
+	{
+		block += 16;
+		stops = quote_stops(block, quote);
+	}
+	return (block - input + __builtin_ctz(stops));
+}
+
+#endif
@@ -11,29 +11,21 @@
 /* ************************************************************************** */
 
 #include "../../includes/minishell.h"
-#include "../../libft/libft.h"
 
-t_token	*token_create(t_token_type type, char *value, int pos)
+t_token	*token_create(t_lexer *lex, t_token_type type, int start, int len)
 {
 	t_token	*token;
-	char	*val_copy;
 
-	token = (t_token *)malloc(sizeof(t_token));
+	token = (t_token *)arena_alloc(lex->arena, sizeof(t_token));
 	if (!token)
 		return (NULL);
-	val_copy = NULL;
-	if (value)
-	{
-		val_copy = ft_strdup(value);
-		if (!val_copy)
-		{
-			free(token);
-			return (NULL);
-		}
-	}
 	token->type = type;
-	token->value = val_copy;
-	token->pos = pos;
+	token->value = NULL;
+	token->start = NULL;
+	if (type != TOKEN_EOF)
+		token->start = lex->input + start;
+	token->len = len;
+	token->pos = start;
 	token->next = NULL;
 	return (token);
 }
@@ -52,21 +44,9 @@ void	token_append(t_lexer *lex, t_token *token)
 	}
 }
 
-void	token_list_free(t_token *tokens)
-{
-	t_token	*temp;
-
-	while (tokens)
-	{
-		temp = tokens->next;
-		if (tokens->value)
-			free(tokens->value);
-		free(tokens);
-		tokens = temp;
-	}
-}
-
-void	free_tokens(t_token *tokens)
+char	*token_value(t_token *token, t_arena *arena)
 {
-	token_list_free(tokens);
+	if (!token->value && token->start)
+		token->value = arena_strndup(arena, token->start, token->len);
+	return (token->value);
 }
@@ -12,29 +12,22 @@
 
 #include "../../includes/minishell.h"
 
-void	lexer_init(t_lexer *lex, char *input)
+void	lexer_init(t_lexer *lex, char *input, t_arena *arena)
 {
 	lex->input = input;
 	lex->pos = 0;
 	lex->start = 0;
-	lex->state = STATE_INITIAL;
+	lex->classes = lexer_classes();
 	lex->tokens = NULL;
 	lex->current = NULL;
+	lex->arena = arena;
 }
 
-void	lexer_free(t_lexer *lex)
-{
-	if (lex->tokens)
-		token_list_free(lex->tokens);
-	lex->tokens = NULL;
-	lex->current = NULL;
-}
-
-t_token	*tokenize(char *input)
+t_token	*tokenize(char *input, t_arena *arena)
 {
 	t_lexer	lex;
 
-	lexer_init(&lex, input);
+	lexer_init(&lex, input, arena);
 	lexer_process(&lex);
 	return (lex.tokens);
 }
@@ -13,43 +13,17 @@
 #include "../includes/minishell.h"
 #include "../includes/executor.h"
 #include "../includes/signals.h"
-#include "../includes/expander.h"
+#include "../libft/libft.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <readline/readline.h>
 #include <readline/history.h>
 
 extern char	**environ;
 
-static void	process_line(char *line, t_exec_ctx *ctx)
-{
-	t_token		*tokens;
-	t_ast_node	*ast;
-	int			status;
-
-	if (!line || line[0] == '\0')
-		return ;
-	tokens = tokenize(line);
-	if (!tokens)
-		return ;
-	if (!validate_syntax(tokens))
-	{
-		free_tokens(tokens);
-		return ;
-	}
-	expand_tokens(tokens, ctx);
-	ast = parse_tokens(tokens);
-	if (!ast)
-	{
-		free_tokens(tokens);
-		return ;
-	}
-	status = execute_ast(ast, ctx);
-	ctx->last_status = status;
-	free_ast(ast);
-	free_tokens(tokens);
-}
-
 static void	shell_loop(t_exec_ctx *ctx)
 {
 	char	*line;
@@ -70,9 +44,83 @@ static void	shell_loop(t_exec_ctx *ctx)
 	}
 }
 
-int	main(void)
+/*
+** Scripts and piped input skip readline entirely: no prompt, no
+** history, and lines come from one large buffered read at a time.
+** Stdin is shared with the commands run, so it is never read past the
+** line being run (see reader_share).
+*/
+static int	script_loop(t_exec_ctx *ctx, int fd)
+{
+	t_reader	reader;
+	char		*line;
+
+	if (!reader_open(&reader, fd))
+		return (1);
+	if (fd == STDIN_FILENO)
+		reader_share(&reader);
+	ctx->reader = &reader;
+	line = reader_next_line(&reader);
+	while (line)
+	{
+		process_line(line, ctx);
+		line = reader_next_line(&reader);
+	}
+	ctx->reader = NULL;
+	reader_close(&reader);
+	return (ctx->last_status);
+}
+
+static int	run_script_file(t_exec_ctx *ctx, char *path)
+{
+	int	fd;
+	int	status;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+	{
+		fprintf(stderr, "minishell: %s: %s\n", path, strerror(errno));
+		return (127);
+	}
+	init_signals();
+	status = script_loop(ctx, fd);
+	close(fd);
+	return (status);
+}
+
+/*
+** -c runs a single line with no readline, history or signal setup, and
+** lets the last external command replace the shell (see exec_tail)
+** unless the line is being timed or traced, which needs the shell to
+** outlive it.
+*/
+static int	run_shell(t_exec_ctx *ctx, int argc, char **argv)
+{
+	if (argc > 1 && ft_strcmp(argv[1], "-c") == 0)
+	{
+		if (argc < 3)
+		{
+			fprintf(stderr, "minishell: -c: option requires an argument\n");
+			return (2);
+		}
+		ctx->exec_tail = (ctx->timing.fd < 0 && ctx->trace.fd < 0);
+		process_line(argv[2], ctx);
+		return (ctx->last_status);
+	}
+	if (argc > 1)
+		return (run_script_file(ctx, argv[1]));
+	init_signals();
+	if (!isatty(STDIN_FILENO))
+		return (script_loop(ctx, STDIN_FILENO));
+	ctx->interactive = 1;
+	shell_loop(ctx);
+	return (0);
+}
+
+int	main(int argc, char **argv)
 {
 	t_exec_ctx	*ctx;
+	int			status;
 
 	ctx = init_exec_ctx(environ);
 	if (!ctx)
@@ -80,8 +128,7 @@ int	main(void)
 		fprintf(stderr, "minishell: failed to initialize\n");
 		return (1);
 	}
-	init_signals();
-	shell_loop(ctx);
+	status = run_shell(ctx, argc, argv);
 	cleanup_exec_ctx(ctx);
-	return (0);
+	return (status);
 }
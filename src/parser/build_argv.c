@@ -11,7 +11,6 @@
 /* ************************************************************************** */
 
 #include "../../includes/minishell.h"
-#include "../../libft/libft.h"
 
 void	fill_argv_array(struct s_parse_ctx *ctx, char **argv, int count)
 {
@@ -20,10 +19,9 @@ void	fill_argv_array(struct s_parse_ctx *ctx, char **argv, int count)
 	i = 0;
 	while (i < count && ctx->curr && ctx->curr->type == TOKEN_WORD)
 	{
-		argv[i] = ft_strdup(ctx->curr->value);
+		argv[i] = token_value(ctx->curr, ctx->arena);
 		if (!argv[i])
 		{
-			free_argv(argv);
 			ctx->error = 1;
 			return ;
 		}
@@ -39,7 +37,7 @@ char	**build_argv(struct s_parse_ctx *ctx, int *count)
 	*count = count_words(ctx);
 	if (*count == 0)
 		return (NULL);
-	argv = alloc_argv_array(*count);
+	argv = alloc_argv_array(ctx->arena, *count);
 	if (!argv)
 	{
 		ctx->error = 1;
@@ -12,11 +12,11 @@
 
 #include "../../includes/minishell.h"
 
-t_ast_node	*create_cmd_node(char **argv, t_redirect *redir)
+t_ast_node	*create_cmd_node(t_arena *arena, char **argv, t_redirect *redir)
 {
 	t_ast_node	*node;
 
-	node = (t_ast_node *)malloc(sizeof(t_ast_node));
+	node = (t_ast_node *)arena_alloc(arena, sizeof(t_ast_node));
 	if (!node)
 		return (NULL);
 	node->type = NODE_COMMAND;
@@ -25,12 +25,12 @@ t_ast_node	*create_cmd_node(char **argv, t_redirect *redir)
 	return (node);
 }
 
-t_ast_node	*create_binop_node(t_node_type type,
+t_ast_node	*create_binop_node(t_arena *arena, t_node_type type,
 				t_ast_node *left, t_ast_node *right)
 {
 	t_ast_node	*node;
 
-	node = (t_ast_node *)malloc(sizeof(t_ast_node));
+	node = (t_ast_node *)arena_alloc(arena, sizeof(t_ast_node));
 	if (!node)
 		return (NULL);
 	node->type = type;
@@ -39,11 +39,59 @@ t_ast_node	*create_binop_node(t_node_type type,
 	return (node);
 }
 
-t_ast_node	*create_subshell_node(t_ast_node *child, t_redirect *redir)
+t_ast_node	*create_pipeline_node(t_arena *arena, t_ast_node *first)
 {
 	t_ast_node	*node;
 
-	node = (t_ast_node *)malloc(sizeof(t_ast_node));
+	node = (t_ast_node *)arena_alloc(arena, sizeof(t_ast_node));
+	if (!node)
+		return (NULL);
+	node->type = NODE_PIPE;
+	node->data.pipeline.capacity = 4;
+	node->data.pipeline.stages = (t_ast_node **)arena_alloc(arena,
+			sizeof(t_ast_node *) * node->data.pipeline.capacity);
+	if (!node->data.pipeline.stages)
+		return (NULL);
+	node->data.pipeline.stages[0] = first;
+	node->data.pipeline.count = 1;
+	return (node);
+}
+
+/*
+** The outgrown stage array stays in the arena until the line is done.
+*/
+int	pipeline_add_stage(t_arena *arena, t_ast_node *node, t_ast_node *stage)
+{
+	t_pipeline_node	*pl;
+	t_ast_node		**grown;
+	int				i;
+
+	pl = &node->data.pipeline;
+	if (pl->count == pl->capacity)
+	{
+		grown = (t_ast_node **)arena_alloc(arena, sizeof(t_ast_node *)
+				* pl->capacity * 2);
+		if (!grown)
+			return (0);
+		i = 0;
+		while (i < pl->count)
+		{
+			grown[i] = pl->stages[i];
+			i++;
+		}
+		pl->stages = grown;
+		pl->capacity *= 2;
+	}
+	pl->stages[pl->count++] = stage;
+	return (1);
+}
+
+t_ast_node	*create_subshell_node(t_arena *arena, t_ast_node *child,
+				t_redirect *redir)
+{
+	t_ast_node	*node;
+
+	node = (t_ast_node *)arena_alloc(arena, sizeof(t_ast_node));
 	if (!node)
 		return (NULL);
 	node->type = NODE_SUBSHELL;
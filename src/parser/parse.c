@@ -23,29 +23,18 @@ static t_ast_node	*parse_with_context(t_parse_ctx *ctx)
 		return (NULL);
 	if (!is_at_end(ctx))
 	{
-		syntax_error(ctx->curr->value);
-		free_ast(ast);
+		syntax_error(token_value(ctx->curr, ctx->arena));
 		return (NULL);
 	}
 	return (ast);
 }
 
-t_ast_node	*parse_tokens(t_token *tokens)
+t_ast_node	*parse_tokens(t_token *tokens, t_arena *arena)
 {
-	t_parse_ctx	*ctx;
-	t_ast_node	*ast;
+	t_parse_ctx	ctx;
 
 	if (!tokens)
 		return (NULL);
-	ctx = init_parse_ctx(tokens);
-	if (!ctx)
-		return (NULL);
-	ast = parse_with_context(ctx);
-	if (!ast)
-	{
-		free(ctx);
-		return (NULL);
-	}
-	free(ctx);
-	return (ast);
+	init_parse_ctx(&ctx, tokens, arena);
+	return (parse_with_context(&ctx));
 }
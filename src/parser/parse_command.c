@@ -84,15 +84,8 @@ t_ast_node	*parse_command(t_parse_ctx *ctx)
 		ctx->error = 1;
 		return (NULL);
 	}
-	node = create_cmd_node(argv, redir);
+	node = create_cmd_node(ctx->arena, argv, redir);
 	if (!node)
-	{
 		ctx->error = 1;
-		if (argv)
-			free_argv(argv);
-		if (redir)
-			free_redirect_list(redir);
-		return (NULL);
-	}
 	return (node);
 }
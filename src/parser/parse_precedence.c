@@ -14,28 +14,29 @@
 
 t_ast_node	*parse_pipe(t_parse_ctx *ctx)
 {
-	t_ast_node	*left;
-	t_ast_node	*right;
+	t_ast_node	*pipeline;
+	t_ast_node	*stage;
 
-	left = parse_primary(ctx);
-	if (!left || ctx->error)
-		return (left);
+	stage = parse_primary(ctx);
+	if (!stage || ctx->error || ctx->curr->type != TOKEN_PIPE)
+		return (stage);
+	pipeline = create_pipeline_node(ctx->arena, stage);
+	if (!pipeline)
+	{
+		ctx->error = 1;
+		return (NULL);
+	}
 	while (match_token(ctx, TOKEN_PIPE))
 	{
-		right = parse_primary(ctx);
-		if (!right || ctx->error)
-		{
-			free_ast(left);
-			return (NULL);
-		}
-		left = make_binop(NODE_PIPE, left, right);
-		if (!left)
+		stage = parse_primary(ctx);
+		if (!stage || ctx->error
+			|| !pipeline_add_stage(ctx->arena, pipeline, stage))
 		{
 			ctx->error = 1;
 			return (NULL);
 		}
 	}
-	return (left);
+	return (pipeline);
 }
 
 t_ast_node	*parse_and(t_parse_ctx *ctx)
@@ -50,11 +51,8 @@ t_ast_node	*parse_and(t_parse_ctx *ctx)
 	{
 		right = parse_pipe(ctx);
 		if (!right || ctx->error)
-		{
-			free_ast(left);
 			return (NULL);
-		}
-		left = make_binop(NODE_AND, left, right);
+		left = make_binop(ctx, NODE_AND, left, right);
 		if (!left)
 		{
 			ctx->error = 1;
@@ -76,11 +74,8 @@ t_ast_node	*parse_or(t_parse_ctx *ctx)
 	{
 		right = parse_and(ctx);
 		if (!right || ctx->error)
-		{
-			free_ast(left);
 			return (NULL);
-		}
-		left = make_binop(NODE_OR, left, right);
+		left = make_binop(ctx, NODE_OR, left, right);
 		if (!left)
 		{
 			ctx->error = 1;
@@ -26,11 +26,10 @@ static t_ast_node	*parse_subshell(t_parse_ctx *ctx)
 	{
 		syntax_error(")");
 		ctx->error = 1;
-		free_ast(child);
 		return (NULL);
 	}
 	redir = parse_redirections(ctx);
-	node = create_subshell_node(child, redir);
+	node = create_subshell_node(ctx->arena, child, redir);
 	if (!node)
 		ctx->error = 1;
 	return (node);
@@ -42,7 +41,7 @@ t_ast_node	*parse_primary(t_parse_ctx *ctx)
 		return (parse_subshell(ctx));
 	if (is_command_start(ctx))
 		return (parse_command(ctx));
-	syntax_error(ctx->curr->value);
+	syntax_error(token_value(ctx->curr, ctx->arena));
 	ctx->error = 1;
 	return (NULL);
 }
@@ -26,21 +26,20 @@ t_redir_type	token_to_redir(t_token_type type)
 	return (REDIR_IN);
 }
 
-t_redirect	*create_redirect(t_token_type type, char *file)
+t_redirect	*create_redirect(t_arena *arena, t_token_type type, char *file)
 {
 	t_redirect	*redir;
 
-	redir = (t_redirect *)malloc(sizeof(t_redirect));
+	if (!file)
+		return (NULL);
+	redir = (t_redirect *)arena_alloc(arena, sizeof(t_redirect));
 	if (!redir)
 		return (NULL);
 	redir->type = token_to_redir(type);
-	redir->file = ft_strdup(file);
-	if (!redir->file)
-	{
-		free(redir);
-		return (NULL);
-	}
+	redir->file = file;
 	redir->heredoc_fd = -1;
+	redir->quoted = 0;
+	redir->expand = 0;
 	redir->next = NULL;
 	return (redir);
 }
@@ -60,6 +59,10 @@ void	append_redirect(t_redirect **head, t_redirect *new)
 	curr->next = new;
 }
 
+/*
+** Any quote in a heredoc delimiter (<<'EOF', <<"EOF") turns off
+** expansion of the body; the quotes themselves are already removed.
+*/
 t_redirect	*parse_single_redir(t_parse_ctx *ctx)
 {
 	t_token_type	type;
@@ -73,12 +76,16 @@ t_redirect	*parse_single_redir(t_parse_ctx *ctx)
 		ctx->error = 1;
 		return (NULL);
 	}
-	redir = create_redirect(type, ctx->curr->value);
+	redir = create_redirect(ctx->arena, type,
+			token_value(ctx->curr, ctx->arena));
 	if (!redir)
 	{
 		ctx->error = 1;
 		return (NULL);
 	}
+	if (type == TOKEN_REDIR_HEREDOC)
+		redir->quoted = (ft_memchr(ctx->curr->start, '\'', ctx->curr->len)
+				|| ft_memchr(ctx->curr->start, '"', ctx->curr->len));
 	advance_token(ctx);
 	return (redir);
 }
@@ -93,10 +100,7 @@ t_redirect	*parse_redirections(t_parse_ctx *ctx)
 	{
 		redir = parse_single_redir(ctx);
 		if (!redir)
-		{
-			free_redirect_list(head);
 			return (NULL);
-		}
 		append_redirect(&head, redir);
 	}
 	return (head);
@@ -32,11 +32,11 @@ int	is_operator_token(t_token_type type)
 	return (0);
 }
 
-char	**alloc_argv_array(int count)
+char	**alloc_argv_array(t_arena *arena, int count)
 {
 	char	**argv;
 
-	argv = (char **)malloc(sizeof(char *) * (count + 1));
+	argv = (char **)arena_alloc(arena, sizeof(char *) * (count + 1));
 	if (!argv)
 		return (NULL);
 	argv[count] = NULL;
@@ -12,17 +12,12 @@
 
 #include "../../includes/minishell.h"
 
-t_parse_ctx	*init_parse_ctx(t_token *tokens)
+void	init_parse_ctx(t_parse_ctx *ctx, t_token *tokens, t_arena *arena)
 {
-	t_parse_ctx	*ctx;
-
-	ctx = (t_parse_ctx *)malloc(sizeof(t_parse_ctx));
-	if (!ctx)
-		return (NULL);
 	ctx->curr = tokens;
 	ctx->tokens = tokens;
 	ctx->error = 0;
-	return (ctx);
+	ctx->arena = arena;
 }
 
 int	is_command_start(t_parse_ctx *ctx)
@@ -45,15 +40,8 @@ int	has_command_word(t_parse_ctx *ctx)
 	return (0);
 }
 
-t_ast_node	*make_binop(t_node_type type, t_ast_node *l, t_ast_node *r)
-{
-	return (create_binop_node(type, l, r));
-}
-
-void	cleanup_parse(t_parse_ctx *ctx, t_ast_node *node)
+t_ast_node	*make_binop(t_parse_ctx *ctx, t_node_type type,
+				t_ast_node *l, t_ast_node *r)
 {
-	if (node)
-		free_ast(node);
-	if (ctx)
-		free(ctx);
+	return (create_binop_node(ctx->arena, type, l, r));
 }
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   process_line.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+#include "../includes/expander.h"
+#include "../libft/libft.h"
+
+static void	run_tokens(t_token *tokens, t_exec_ctx *ctx, t_arena *arena)
+{
+	t_ast_node	*ast;
+
+	timing_lap(&ctx->timing, PHASE_TOKENIZE);
+	if (!tokens)
+		return ;
+	if (!validate_syntax(tokens))
+	{
+		ctx->last_status = 2;
+		return ;
+	}
+	timing_lap(&ctx->timing, PHASE_VALIDATE);
+	expand_tokens(tokens, ctx, arena);
+	timing_lap(&ctx->timing, PHASE_EXPAND);
+	ast = parse_tokens(tokens, arena);
+	timing_lap(&ctx->timing, PHASE_PARSE);
+	if (ast && collect_heredocs(ast, ctx) == -1)
+		ctx->last_status = 1;
+	else if (ast)
+		ctx->last_status = execute_ast(ast, ctx);
+	close_all_heredocs(ast, ctx);
+	timing_lap(&ctx->timing, PHASE_EXEC);
+}
+
+/*
+** Everything built from the line is allocated in ctx->line_arena and
+** released in one reset once the line has executed. Tokens and most
+** argv entries point into the line itself; a line from the script
+** reader is first moved into the arena, because heredoc bodies are read
+** from the same reader while the command runs and would overwrite it.
+*/
+void	process_line(char *line, t_exec_ctx *ctx)
+{
+	t_token		*tokens;
+	t_arena		*arena;
+
+	if (!line || line[0] == '\0')
+		return ;
+	arena = &ctx->line_arena;
+	timing_begin(&ctx->timing);
+	if (ctx->reader)
+		line = arena_strndup(arena, line, ft_strlen(line));
+	tokens = NULL;
+	if (line)
+		tokens = tokenize(line, arena);
+	run_tokens(tokens, ctx, arena);
+	timing_end(&ctx->timing);
+	arena_reset(arena);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arena.h"
+
+void	arena_init(t_arena *arena)
+{
+	arena->head = NULL;
+}
+
+static t_arena_block	*arena_grow(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	size_t			cap;
+
+	cap = ARENA_BLOCK_SIZE;
+	if (arena->head && arena->head->size >= cap)
+		cap = arena->head->size * 2;
+	while (cap < size)
+		cap *= 2;
+	block = (t_arena_block *)malloc(sizeof(t_arena_block) + cap);
+	if (!block)
+		return (NULL);
+	block->next = arena->head;
+	block->size = cap;
+	block->used = 0;
+	arena->head = block;
+	return (block);
+}
+
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_block	*block;
+	void			*ptr;
+
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	block = arena->head;
+	if (!block || block->used + size > block->size)
+	{
+		block = arena_grow(arena, size);
+		if (!block)
+			return (NULL);
+	}
+	ptr = (char *)(block + 1) + block->used;
+	block->used += size;
+	return (ptr);
+}
+
+/*
+** Blocks grow geometrically, so the head is the largest one: keep it
+** and a line of similar size next time needs no malloc at all.
+*/
+void	arena_reset(t_arena *arena)
+{
+	t_arena_block	*block;
+	t_arena_block	*next;
+
+	if (!arena->head)
+		return ;
+	block = arena->head->next;
+	while (block)
+	{
+		next = block->next;
+		free(block);
+		block = next;
+	}
+	arena->head->next = NULL;
+	arena->head->used = 0;
+}
+
+void	arena_free(t_arena *arena)
+{
+	arena_reset(arena);
+	free(arena->head);
+	arena->head = NULL;
+}
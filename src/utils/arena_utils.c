@@ -0,0 +1,26 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arena.h"
+#include "../../libft/libft.h"
+
+char	*arena_strndup(t_arena *arena, const char *s, size_t n)
+{
+	char	*copy;
+
+	copy = (char *)arena_alloc(arena, n + 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   line_reader.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/reader.h"
+#include "../../libft/libft.h"
+#include <errno.h>
+#include <unistd.h>
+
+static int	reader_fill(t_reader *r)
+{
+	ssize_t	n;
+
+	n = read(r->fd, r->buf, r->chunk);
+	while (n == -1 && errno == EINTR)
+		n = read(r->fd, r->buf, r->chunk);
+	if (n <= 0)
+		return (0);
+	r->pos = 0;
+	r->end = n;
+	return (1);
+}
+
+static char	*take_line(t_reader *r, char *nl)
+{
+	char	*line;
+
+	line = r->buf + r->pos;
+	*nl = '\0';
+	r->pos = nl - r->buf + 1;
+	if (r->rewind && r->pos < r->end
+		&& lseek(r->fd, (off_t)r->pos - (off_t)r->end, SEEK_CUR) != -1)
+		r->end = r->pos;
+	if (r->line.len == 0)
+		return (line);
+	if (!sb_append_n(&r->line, line, nl - line))
+		return (NULL);
+	return (r->line.data);
+}
+
+char	*reader_next_line(t_reader *r)
+{
+	char	*nl;
+
+	sb_reset(&r->line);
+	while (1)
+	{
+		if (r->pos == r->end && !reader_fill(r))
+		{
+			if (r->line.len == 0)
+				return (NULL);
+			return (r->line.data);
+		}
+		nl = ft_memchr(r->buf + r->pos, '\n', r->end - r->pos);
+		if (nl)
+			return (take_line(r, nl));
+		if (!sb_append_n(&r->line, r->buf + r->pos, r->end - r->pos))
+			return (NULL);
+		r->pos = r->end;
+	}
+}
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reader_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/reader.h"
+#include <unistd.h>
+
+int	reader_open(t_reader *r, int fd)
+{
+	r->fd = fd;
+	r->pos = 0;
+	r->end = 0;
+	r->chunk = READER_BUF_SIZE;
+	r->rewind = 0;
+	sb_init(&r->line);
+	r->buf = (char *)malloc(READER_BUF_SIZE);
+	return (r->buf != NULL);
+}
+
+/*
+** Seekable input keeps block reads and is rewound after each line, the
+** way bash does it; a pipe has to be read a byte at a time.
+*/
+void	reader_share(t_reader *r)
+{
+	if (lseek(r->fd, 0, SEEK_CUR) != -1)
+		r->rewind = 1;
+	else
+		r->chunk = 1;
+}
+
+void	reader_close(t_reader *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+	sb_free(&r->line);
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/strbuf.h"
+#include "../../libft/libft.h"
+
+void	sb_init(t_strbuf *sb)
+{
+	sb->data = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+}
+
+int	sb_reserve(t_strbuf *sb, size_t extra)
+{
+	char	*grown;
+	size_t	cap;
+
+	if (sb->len + extra + 1 <= sb->cap)
+		return (1);
+	cap = sb->cap;
+	if (cap < STRBUF_MIN_CAP)
+		cap = STRBUF_MIN_CAP;
+	while (cap < sb->len + extra + 1)
+		cap *= 2;
+	grown = (char *)malloc(cap);
+	if (!grown)
+		return (0);
+	ft_memcpy(grown, sb->data, sb->len);
+	grown[sb->len] = '\0';
+	free(sb->data);
+	sb->data = grown;
+	sb->cap = cap;
+	return (1);
+}
+
+int	sb_append_n(t_strbuf *sb, const char *s, size_t n)
+{
+	if (!sb_reserve(sb, n))
+		return (0);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+int	sb_append_char(t_strbuf *sb, char c)
+{
+	if (!sb_reserve(sb, 1))
+		return (0);
+	sb->data[sb->len++] = c;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+int	sb_append_str(t_strbuf *sb, const char *s)
+{
+	return (sb_append_n(sb, s, ft_strlen(s)));
+}
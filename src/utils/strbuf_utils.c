@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf_utils.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/strbuf.h"
+#include "../../libft/libft.h"
+
+void	sb_reset(t_strbuf *sb)
+{
+	sb->len = 0;
+	if (sb->data)
+		sb->data[0] = '\0';
+}
+
+char	*sb_dup(t_strbuf *sb)
+{
+	char	*copy;
+
+	copy = (char *)malloc(sb->len + 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, sb->data, sb->len);
+	copy[sb->len] = '\0';
+	return (copy);
+}
+
+void	sb_free(t_strbuf *sb)
+{
+	free(sb->data);
+	sb_init(sb);
+}
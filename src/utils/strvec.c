@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strvec.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/strvec.h"
+#include "../../libft/libft.h"
+
+void	sv_init(t_strvec *sv)
+{
+	sv->items = NULL;
+	sv->len = 0;
+	sv->cap = 0;
+}
+
+static int	sv_grow(t_strvec *sv)
+{
+	char	**grown;
+	size_t	cap;
+
+	cap = sv->cap * 2;
+	if (cap < STRVEC_MIN_CAP)
+		cap = STRVEC_MIN_CAP;
+	grown = (char **)malloc(sizeof(char *) * cap);
+	if (!grown)
+		return (0);
+	ft_memcpy(grown, sv->items, sizeof(char *) * sv->len);
+	free(sv->items);
+	sv->items = grown;
+	sv->cap = cap;
+	return (1);
+}
+
+int	sv_push(t_strvec *sv, char *str)
+{
+	if (!str)
+		return (0);
+	if (sv->len + 1 >= sv->cap && !sv_grow(sv))
+		return (0);
+	sv->items[sv->len++] = str;
+	sv->items[sv->len] = NULL;
+	return (1);
+}
+
+int	sv_push_dup(t_strvec *sv, char *str)
+{
+	char	*copy;
+
+	copy = ft_strdup(str);
+	if (!copy)
+		return (0);
+	if (!sv_push(sv, copy))
+	{
+		free(copy);
+		return (0);
+	}
+	return (1);
+}
+
+void	sv_free(t_strvec *sv, int free_items)
+{
+	size_t	i;
+
+	i = 0;
+	while (free_items && i < sv->len)
+	{
+		free(sv->items[i]);
+		i++;
+	}
+	free(sv->items);
+	sv_init(sv);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/timing.h"
+#include <time.h>
+
+long long	timing_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+void	timing_begin(t_timing *timing)
+{
+	int	i;
+
+	timing->line++;
+	if (timing->fd < 0)
+		return ;
+	i = 0;
+	while (i < PHASE_COUNT)
+		timing->ns[i++] = 0;
+	timing->spawns = 0;
+	timing->begin = timing_now();
+	timing->last = timing->begin;
+}
+
+/*
+** Charge the time since the previous lap to phase; for the phases of
+** process_line, which follow each other.
+*/
+void	timing_lap(t_timing *timing, t_phase phase)
+{
+	long long	now;
+
+	if (timing->fd < 0)
+		return ;
+	now = timing_now();
+	timing->ns[phase] += now - timing->last;
+	timing->last = now;
+}
+
+/*
+** timing_start and timing_add bracket a phase nested inside exec.
+*/
+long long	timing_start(t_timing *timing)
+{
+	if (timing->fd < 0)
+		return (0);
+	return (timing_now());
+}
+
+void	timing_add(t_timing *timing, t_phase phase, long long start)
+{
+	if (timing->fd < 0)
+		return ;
+	timing->ns[phase] += timing_now() - start;
+	if (phase == PHASE_SPAWN)
+		timing->spawns++;
+}
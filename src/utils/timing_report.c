@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/timing.h"
+#include "../../libft/libft.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+void	timing_close(t_timing *timing)
+{
+	if (timing->fd > STDERR_FILENO)
+		close(timing->fd);
+	timing->fd = -1;
+}
+
+/*
+** (Re)read the MINISHELL_TIMING setting; called at startup and whenever
+** export or unset touches the variable. The line that switches timing on
+** was not measured from its start, so it is not reported.
+*/
+void	timing_init(t_timing *timing, char *setting)
+{
+	timing_close(timing);
+	timing->begin = 0;
+	if (!setting || !*setting || ft_strcmp(setting, "0") == 0)
+		return ;
+	if (ft_strcmp(setting, "1") == 0 || ft_strcmp(setting, "stderr") == 0)
+	{
+		timing->fd = STDERR_FILENO;
+		return ;
+	}
+	timing->fd = open(setting, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+			0644);
+	if (timing->fd < 0)
+		fprintf(stderr, "minishell: %s: %s\n", setting, strerror(errno));
+}
+
+void	timing_end(t_timing *timing)
+{
+	long long	*ns;
+
+	if (timing->fd < 0 || timing->begin == 0)
+		return ;
+	ns = timing->ns;
+	dprintf(timing->fd, "timing line=%ld tokenize_ns=%lld validate_ns=%lld "
+		"expand_ns=%lld parse_ns=%lld exec_ns=%lld heredoc_ns=%lld "
+		"spawn_ns=%lld wait_ns=%lld total_ns=%lld spawns=%d\n",
+		timing->line, ns[PHASE_TOKENIZE], ns[PHASE_VALIDATE],
+		ns[PHASE_EXPAND], ns[PHASE_PARSE], ns[PHASE_EXEC],
+		ns[PHASE_HEREDOC], ns[PHASE_SPAWN], ns[PHASE_WAIT],
+		timing_now() - timing->begin, timing->spawns);
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/trace.h"
+#include "../../includes/timing.h"
+#include "../../libft/libft.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+** Names are argv[0] as typed; quotes, backslashes and control bytes
+** would break the JSON string, so they are escaped or replaced.
+*/
+static void	json_escape(char *dst, const char *src, size_t size)
+{
+	size_t	i;
+
+	i = 0;
+	while (src && *src && i + 2 < size)
+	{
+		if (*src == '"' || *src == '\\')
+			dst[i++] = '\\';
+		if ((unsigned char)*src < 0x20)
+			dst[i++] = '?';
+		else
+			dst[i++] = *src;
+		src++;
+	}
+	dst[i] = '\0';
+}
+
+/*
+** Every event goes out in a single write, so that the shell and its
+** forked children can append to the file concurrently.
+*/
+void	trace_write(t_trace *trace, t_trace_child *event, int status)
+{
+	char		name[TRACE_NAME_MAX];
+	char		buf[TRACE_EVENT_MAX];
+	long long	dur;
+	int			len;
+
+	if (trace->fd < 0)
+		return ;
+	json_escape(name, event->name, sizeof(name));
+	dur = timing_now() - event->start;
+	len = snprintf(buf, sizeof(buf), ",\n{\"name\":\"%s\",\"ph\":\"X\","
+			"\"ts\":%lld.%03lld,\"dur\":%lld.%03lld,\"pid\":%d,\"tid\":%d,"
+			"\"args\":{\"pid\":%d,\"status\":%d}}", name,
+			event->start / 1000, event->start % 1000, dur / 1000, dur % 1000,
+			getpid(), event->pid, event->pid, status);
+	if (len > 0 && len < (int) sizeof(buf))
+		write(trace->fd, buf, len);
+}
+
+/*
+** (Re)read the MINISHELL_TRACE setting; called at startup and whenever
+** export or unset touches the variable. The file starts with a metadata
+** event, so that every event after it can lead with its comma.
+*/
+void	trace_init(t_trace *trace, char *path)
+{
+	trace_close(trace);
+	trace->owner = getpid();
+	trace->count = 0;
+	if (!path || !*path)
+		return ;
+	trace->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND
+			| O_CLOEXEC, 0644);
+	if (trace->fd < 0)
+	{
+		fprintf(stderr, "minishell: %s: %s\n", path, strerror(errno));
+		return ;
+	}
+	dprintf(trace->fd, "[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+		"\"args\":{\"name\":\"minishell\"}}", trace->owner);
+}
+
+/*
+** Only the shell that opened the file ends the array; forked children
+** just drop their copy of the descriptor.
+*/
+void	trace_close(t_trace *trace)
+{
+	if (trace->fd < 0)
+		return ;
+	if (getpid() == trace->owner)
+		write(trace->fd, "\n]\n", 3);
+	close(trace->fd);
+	trace->fd = -1;
+}
+
+void	trace_event(t_trace *trace, const char *name, long long start,
+		int status)
+{
+	t_trace_child	event;
+
+	if (trace->fd < 0)
+		return ;
+	event.pid = getpid();
+	event.start = start;
+	event.name = name;
+	trace_write(trace, &event, status);
+}
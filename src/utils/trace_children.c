@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_children.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/trace.h"
+
+/*
+** A child's event is written when it is reaped, so its start and name
+** wait here in the meantime. A pipeline wider than TRACE_MAX_CHILDREN
+** loses the events of its last stages.
+*/
+void	trace_spawned(t_trace *trace, int pid, const char *name,
+		long long start)
+{
+	t_trace_child	*child;
+
+	if (trace->fd < 0 || pid <= 0 || trace->count >= TRACE_MAX_CHILDREN)
+		return ;
+	child = &trace->children[trace->count++];
+	child->pid = pid;
+	child->start = start;
+	child->name = name;
+}
+
+void	trace_reaped(t_trace *trace, int pid, int status)
+{
+	int	i;
+
+	if (trace->fd < 0)
+		return ;
+	i = 0;
+	while (i < trace->count && trace->children[i].pid != pid)
+		i++;
+	if (i == trace->count)
+		return ;
+	trace_write(trace, &trace->children[i], status);
+	trace->children[i] = trace->children[--trace->count];
+}
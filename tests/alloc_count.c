@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_count.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** LD_PRELOAD shim for tests/bench_allocs.sh: counts heap calls made by
+** the process it was loaded into and prints them to stderr at exit.
+** Forked children inherit the counters but stay silent.
+**
+** tests/bench_micro.c links this file in directly and reads the counters
+** through alloc_count_read instead; the exit report is then skipped.
+**
+** Counting wraps glibc's __libc_* entry points, which other C libraries
+** (macOS libSystem, musl) do not export. Elsewhere nothing is wrapped and
+** alloc_count_read returns 0 so callers can report the counts as n/a.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#ifdef __GLIBC__
+
+void					*__libc_malloc(size_t size);
+void					*__libc_calloc(size_t n, size_t size);
+void					*__libc_realloc(void *ptr, size_t size);
+void					__libc_free(void *ptr);
+
+static unsigned long	g_allocs;
+static unsigned long	g_bytes;
+static unsigned long	g_frees;
+static pid_t			g_owner;
+
+void	*malloc(size_t size)
+{
+	g_allocs++;
+	g_bytes += size;
+	return (__libc_malloc(size));
+}
+
+void	*calloc(size_t n, size_t size)
+{
+	g_allocs++;
+	g_bytes += n * size;
+	return (__libc_calloc(n, size));
+}
+
+void	*realloc(void *ptr, size_t size)
+{
+	g_allocs++;
+	g_bytes += size;
+	return (__libc_realloc(ptr, size));
+}
+
+void	free(void *ptr)
+{
+	if (ptr)
+		g_frees++;
+	__libc_free(ptr);
+}
+
+int	alloc_count_read(unsigned long *allocs, unsigned long *bytes)
+{
+	g_owner = 0;
+	*allocs = g_allocs;
+	*bytes = g_bytes;
+	return (1);
+}
+
+__attribute__((constructor))
+static void	count_start(void)
+{
+	g_owner = getpid();
+}
+
+__attribute__((destructor))
+static void	count_report(void)
+{
+	if (getpid() != g_owner)
+		return ;
+	fprintf(stderr, "allocs=%lu bytes=%lu frees=%lu\n",
+		g_allocs, g_bytes, g_frees);
+}
+
+#else
+
+int	alloc_count_read(unsigned long *allocs, unsigned long *bytes)
+{
+	*allocs = 0;
+	*bytes = 0;
+	return (0);
+}
+
+#endif
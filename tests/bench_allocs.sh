@@ -0,0 +1,79 @@
+#!/bin/bash
+
+# Allocation count benchmark
+# Preloads tests/alloc_count.c into minishell and feeds it a batch of
+# builtin-only command lines (nothing forks or execs, so every counted
+# call belongs to the shell itself). The cost of starting up is measured
+# separately and subtracted, leaving heap calls per command line.
+#
+# Usage: tests/bench_allocs.sh [lines]
+#   lines  number of command lines in the batch (default 10000)
+#
+# MINISHELL can be set to measure another build.
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+LINES=${1:-10000}
+WORKDIR=$(mktemp -d)
+SHIM="$WORKDIR/alloc_count.so"
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+if ! cc -shared -fPIC -O2 -o "$SHIM" "$SCRIPT_DIR/alloc_count.c"; then
+    echo -e "${RED}Error: could not build the counting shim${NC}"
+    exit 1
+fi
+
+# A mix of words, quotes, expansions, redirections and operators
+build_workload() {
+    for ((i = 0; i < LINES; i++)); do
+        echo "echo alpha beta \"gamma \$HOME\" 'delta' > /dev/null" \
+            "&& echo one two three four < /dev/null > /dev/null" \
+            "|| echo never"
+    done
+}
+
+# Run a workload file and print "allocs bytes frees"
+count_run() {
+    LD_PRELOAD="$SHIM" "$MINISHELL" < "$1" 2>&1 > /dev/null \
+        | sed -n 's/^allocs=\([0-9]*\) bytes=\([0-9]*\) frees=\([0-9]*\)$/\1 \2 \3/p' \
+        | tail -n 1
+}
+
+echo "=================================="
+echo "Minishell allocation benchmark"
+echo "=================================="
+echo "Command lines: $LINES"
+echo ""
+
+build_workload > "$WORKDIR/batch"
+: > "$WORKDIR/empty"
+read -r base_allocs base_bytes base_frees < <(count_run "$WORKDIR/empty")
+read -r allocs bytes frees < <(count_run "$WORKDIR/batch")
+
+# The shim only counts on glibc; elsewhere it never reports
+if [ -z "$base_allocs" ] || [ -z "$allocs" ]; then
+    echo -e "${RED}Error: no counts reported (the shim needs glibc and" \
+        "LD_PRELOAD)${NC}"
+    exit 1
+fi
+
+echo -e "${BLUE}startup:${NC} $base_allocs allocs, $base_bytes bytes"
+echo -e "${BLUE}per line:${NC}" \
+    "$(( (allocs - base_allocs) / LINES )) allocs," \
+    "$(( (bytes - base_bytes) / LINES )) bytes," \
+    "$(( (frees - base_frees) / LINES )) frees"
+echo -e "${GREEN}Done${NC}"
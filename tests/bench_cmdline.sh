@@ -0,0 +1,50 @@
+#!/bin/bash
+
+# Command-string startup benchmark
+# Starts minishell once per command with -c, the way a caller running
+# one command line per invocation would, and compares the per-call
+# latency with bash -c on the same command.
+#
+# Usage: tests/bench_cmdline.sh [invocations] [command]
+#   invocations  number of shell starts (default 1000)
+#   command      command line to run (default /bin/true)
+#
+# MINISHELL can be set to benchmark another build.
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+RUNS=${1:-1000}
+COMMAND=${2:-/bin/true}
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+# Start the given shell RUNS times and print elapsed nanoseconds
+time_shell() {
+    local start end
+    start=$(date +%s%N)
+    for ((i = 0; i < RUNS; i++)); do
+        "$1" -c "$COMMAND" > /dev/null 2>&1
+    done
+    end=$(date +%s%N)
+    echo $((end - start))
+}
+
+echo "=================================="
+echo "Minishell -c benchmark"
+echo "=================================="
+echo "Invocations: $RUNS, command: $COMMAND"
+echo ""
+
+mini_ns=$(time_shell "$MINISHELL")
+bash_ns=$(time_shell bash)
+echo -e "${BLUE}minishell -c:${NC} $((mini_ns / RUNS / 1000)) us/call"
+echo -e "${BLUE}bash -c:${NC} $((bash_ns / RUNS / 1000)) us/call"
+echo -e "${GREEN}Done${NC}"
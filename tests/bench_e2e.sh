@@ -0,0 +1,152 @@
+#!/bin/bash
+
+# End-to-end cost benchmark
+# Feeds standard workloads to minishell on stdin, and to bash and dash
+# when they are installed, and reports what each shell spent on them:
+# wall time, user and system CPU, peak resident set size, and process
+# IDs used per command (forks, counted through tests/bench_run.c).
+# test_runner.sh checks that minishell gives the same results; this
+# script measures what the results cost.
+#
+# Usage: tests/bench_e2e.sh [scale] [workload...]
+#   scale     multiplier for every workload size (default 1)
+#   workload  run only these: builtins external pipeline vars heredoc glob
+#
+# MINISHELL can be set to measure another build, SHELLS to change the
+# baselines (default "bash dash"), and BENCH_TIMEOUT to change how many
+# seconds one shell may spend on one workload (default 60).
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+SHELLS="${SHELLS:-bash dash}"
+SCALE=${1:-1}
+shift
+WORKLOADS="${*:-builtins external pipeline vars heredoc glob}"
+WORKDIR=$(mktemp -d)
+PROBE="$WORKDIR/bench_run"
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+if ! cc -O2 -o "$PROBE" "$SCRIPT_DIR/bench_run.c"; then
+    echo -e "${RED}Error: could not build tests/bench_run.c${NC}"
+    exit 1
+fi
+
+# Each generator writes the workload to stdout and its command count to
+# $WORKDIR/<name>.cmds: simple commands run, pipeline stages included.
+
+gen_builtins() {
+    local n=$((10000 * SCALE))
+    for ((i = 0; i < n; i++)); do echo "cd ."; done
+    echo $n > "$WORKDIR/builtins.cmds"
+}
+
+gen_external() {
+    local n=$((10000 * SCALE))
+    for ((i = 0; i < n; i++)); do echo "/bin/true"; done
+    echo $n > "$WORKDIR/external.cmds"
+}
+
+# Ten-stage pipelines
+gen_pipeline() {
+    local n=$((200 * SCALE))
+    for ((i = 0; i < n; i++)); do
+        echo "echo data | cat | cat | cat | cat | cat | cat | cat | cat | wc -c > /dev/null"
+    done
+    echo $((n * 10)) > "$WORKDIR/pipeline.cmds"
+}
+
+# Fifty expansions per line, all in builtins
+gen_vars() {
+    local n=$((2000 * SCALE)) line="echo"
+    for ((i = 0; i < 10; i++)); do
+        line="$line \$HOME \$USER \"\$PATH\" \$SHELL \$NOPE_$i"
+    done
+    for ((i = 0; i < n; i++)); do echo "$line > /dev/null"; done
+    echo $n > "$WORKDIR/vars.cmds"
+}
+
+# Heredocs of 5000 lines each, half of them with an expansion
+gen_heredoc() {
+    local n=$((20 * SCALE))
+    for ((i = 0; i < n; i++)); do
+        echo "cat << EOF > /dev/null"
+        for ((j = 0; j < 2500; j++)); do
+            echo "plain heredoc line number $j with some filler text"
+            echo "expanded line for \$USER in \$HOME"
+        done
+        echo "EOF"
+    done
+    echo $n > "$WORKDIR/heredoc.cmds"
+}
+
+# Matching and non-matching patterns over a 5000-entry directory
+gen_glob() {
+    local n=$((100 * SCALE))
+    mkdir -p "$WORKDIR/globdir"
+    (cd "$WORKDIR/globdir" && for ((i = 0; i < 5000; i++)); do
+        : > "entry_$i.txt"
+    done)
+    echo "cd $WORKDIR/globdir"
+    for ((i = 0; i < n; i++)); do
+        echo "echo * > /dev/null"
+        echo "echo *_1*.txt entry_4?9.txt > /dev/null"
+        echo "echo *zz* > /dev/null"
+    done
+    echo $((n * 3 + 1)) > "$WORKDIR/glob.cmds"
+}
+
+# run_one WORKLOAD LABEL SHELL: one result line
+run_one() {
+    local result cmds
+    result=$("$PROBE" "$WORKDIR/$1.sh" "$3" 2> /dev/null)
+    cmds=$(cat "$WORKDIR/$1.cmds")
+    echo "$result" | awk -v w="$1" -v s="$2" -v c="$cmds" '{
+        split($0, kv, /[ =]/)
+        for (i = 1; i < length(kv); i += 2) f[kv[i]] = kv[i + 1]
+        forks = "n/a"
+        if (f["pids"] >= 0) forks = sprintf("%.2f", f["pids"] / c)
+        if (f["timeout"] == 1) {
+            printf "workload=%-9s shell=%-9s timeout\n", w, s
+            next
+        }
+        printf "workload=%-9s shell=%-9s wall_ms=%-9s user_ms=%-9s " \
+            "sys_ms=%-9s maxrss_kb=%-7s forks_per_cmd=%s\n", w, s,
+            f["wall_ms"], f["user_ms"], f["sys_ms"], f["maxrss_kb"], forks
+    }'
+}
+
+echo "=================================="
+echo "Minishell end-to-end benchmark"
+echo "=================================="
+echo "Scale: $SCALE, baselines: $SHELLS"
+echo ""
+
+for workload in $WORKLOADS; do
+    if ! declare -f "gen_$workload" > /dev/null; then
+        echo -e "${RED}Unknown workload: $workload${NC}"
+        continue
+    fi
+    "gen_$workload" > "$WORKDIR/$workload.sh"
+    echo -e "${BLUE}$workload${NC} ($(cat "$WORKDIR/$workload.cmds") commands)"
+    run_one "$workload" minishell "$MINISHELL"
+    for sh in $SHELLS; do
+        if command -v "$sh" > /dev/null; then
+            run_one "$workload" "$sh" "$sh"
+        fi
+    done
+done
+echo -e "${GREEN}Done${NC}"
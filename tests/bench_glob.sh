@@ -0,0 +1,71 @@
+#!/bin/bash
+
+# Glob matcher benchmark
+# Fills a scratch directory with long file names that almost, but never
+# quite, match a series of star-heavy patterns. A backtracking matcher
+# explores every way of splitting the name between the stars on each
+# entry; the linear matcher retries only from the last star.
+#
+# Usage: tests/bench_glob.sh [files] [name_length] [stars]
+#   files        number of entries in the scratch directory (default 200)
+#   name_length  length of each file name (default 60)
+#   stars        number of '*a' groups in the pattern (default 8)
+#
+# MINISHELL can be set to benchmark another build.
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+FILES=${1:-200}
+NAME_LEN=${2:-60}
+STARS=${3:-8}
+WORKDIR=$(mktemp -d)
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+# Names are runs of 'a' with a unique numeric suffix: every pattern
+# below ends in a character no name contains, so nothing ever matches.
+build_dir() {
+    local run
+    run=$(printf '%*s' "$NAME_LEN" '' | tr ' ' 'a')
+    for ((i = 0; i < FILES; i++)); do
+        touch "$WORKDIR/${run}$i"
+    done
+}
+
+# Run one pattern and print elapsed nanoseconds
+time_pattern() {
+    local start end
+    start=$(date +%s%N)
+    (cd "$WORKDIR" && echo "echo $1" | "$MINISHELL" > /dev/null 2>&1)
+    end=$(date +%s%N)
+    echo $((end - start))
+}
+
+echo "=================================="
+echo "Minishell glob benchmark"
+echo "=================================="
+echo "Files: $FILES, name length: $NAME_LEN"
+echo ""
+
+build_dir
+for ((n = 1; n <= STARS; n++)); do
+    pattern="$(printf '*a%.0s' $(seq 1 "$n"))*b"
+    ns=$(time_pattern "$pattern")
+    echo -e "${BLUE}${pattern}:${NC} $((ns / 1000)) us"
+done
+ns=$(time_pattern "*[a-z]?[!b]*[ab]*b")
+echo -e "${BLUE}*[a-z]?[!b]*[ab]*b:${NC} $((ns / 1000)) us"
+echo -e "${GREEN}Done${NC}"
@@ -0,0 +1,76 @@
+#!/bin/bash
+
+# Glob sort benchmark
+# Creates a large scratch directory in shuffled order and expands `*`
+# over it, so the run is dominated by sorting the matches. The output
+# is checked against bash in the C locale: glob results are ordered
+# byte-wise, independent of the user's locale.
+#
+# Usage: tests/bench_glob_sort.sh [files] [runs]
+#   files  number of entries in the scratch directory (default 20000)
+#   runs   number of timed expansions (default 3)
+#
+# MINISHELL can be set to benchmark another build.
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+FILES=${1:-20000}
+RUNS=${2:-3}
+WORKDIR=$(mktemp -d)
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+# Mixed-case names sharing long prefixes, created in random order
+build_dir() {
+    (cd "$WORKDIR" && seq 1 "$FILES" | shuf | while read -r i; do
+        case $((i % 3)) in
+            0) echo "entry_$i" ;;
+            1) echo "Entry_$i" ;;
+            2) echo "_entry.$i" ;;
+        esac
+    done | xargs touch)
+}
+
+# Expand `*` once and print elapsed nanoseconds
+time_expand() {
+    local start end
+    start=$(date +%s%N)
+    (cd "$WORKDIR" && echo "echo *" | "$MINISHELL" > /dev/null 2>&1)
+    end=$(date +%s%N)
+    echo $((end - start))
+}
+
+echo "=================================="
+echo "Minishell glob sort benchmark"
+echo "=================================="
+echo "Files: $FILES, runs: $RUNS"
+echo ""
+
+build_dir
+expected=$(cd "$WORKDIR" && LC_ALL=C bash -c 'echo *')
+got=$(cd "$WORKDIR" && echo "echo *" | "$MINISHELL" 2> /dev/null \
+    | grep -v '^minishell> ')
+if [ "$expected" != "$got" ]; then
+    echo -e "${RED}Order differs from LC_ALL=C bash${NC}"
+    exit 1
+fi
+
+total=0
+for ((r = 0; r < RUNS; r++)); do
+    total=$((total + $(time_expand)))
+done
+echo -e "${BLUE}echo * over $FILES entries:${NC} $((total / RUNS / 1000)) us"
+echo -e "${GREEN}Order matches LC_ALL=C bash${NC}"
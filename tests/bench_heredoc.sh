@@ -0,0 +1,108 @@
+#!/bin/bash
+
+# Heredoc throughput benchmark
+# Runs scripts holding one large heredoc each and reports how fast every
+# shell moves the body from its input into the command, in MB/s of body
+# text. Three bodies: plain lines under an unquoted delimiter, lines with
+# a '$' under a quoted delimiter (copied verbatim), and the same lines
+# under an unquoted delimiter (every line expanded). The command is
+# 'cat > /dev/null', so most of the time is the shell's.
+#
+# Usage: tests/bench_heredoc.sh [megabytes] [runs]
+#   megabytes  size of each heredoc body (default 16)
+#   runs       timed runs per shell and body; the best is kept (default 3)
+#
+# MINISHELL can be set to measure another build, SHELLS to change the
+# baselines (default "bash dash"), and BENCH_TIMEOUT to change how many
+# seconds one run may take (default 60).
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="${MINISHELL:-$SCRIPT_DIR/../minishell}"
+SHELLS="${SHELLS:-bash dash}"
+MEGABYTES=${1:-16}
+RUNS=${2:-3}
+WORKDIR=$(mktemp -d)
+PROBE="$WORKDIR/bench_run"
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+if ! cc -O2 -o "$PROBE" "$SCRIPT_DIR/bench_run.c"; then
+    echo -e "${RED}Error: could not build tests/bench_run.c${NC}"
+    exit 1
+fi
+
+# gen_body LINE: repeat LINE until the body reaches the requested size
+gen_body() {
+    awk -v line="$1" -v bytes=$((MEGABYTES * 1048576)) \
+        'BEGIN { n = 0; while (n < bytes) { print line;
+                 n += length(line) + 1 } }'
+}
+
+# gen_script NAME DELIM LINE
+gen_script() {
+    {
+        echo "cat << $2 > /dev/null"
+        gen_body "$3"
+        echo "EOF"
+    } > "$WORKDIR/$1.sh"
+}
+
+gen_script plain EOF "plain heredoc line of generated configuration data 0123456789"
+gen_script quoted "'EOF'" "raw \$USER payload line kept verbatim, \$HOME and \$PATH untouched"
+gen_script expand EOF "expanded \$USER line for \$HOME with some more filler text"
+
+# run_one BODY LABEL SHELL: best of RUNS, as one result line
+run_one() {
+    local best="" wall i
+    for ((i = 0; i < RUNS; i++)); do
+        wall=$("$PROBE" "$WORKDIR/$1.sh" "$3" 2> /dev/null | awk '
+            /timeout=1/ { print "timeout"; next }
+            { for (i = 1; i <= NF; i++) if ($i ~ /^wall_ms=/) {
+                  sub(/wall_ms=/, "", $i); print $i } }')
+        if [ "$wall" = "timeout" ]; then
+            best="timeout"
+            break
+        fi
+        if [ -z "$best" ] || awk -v a="$wall" -v b="$best" \
+            'BEGIN { exit !(a < b) }'; then
+            best=$wall
+        fi
+    done
+    if [ "$best" = "timeout" ]; then
+        printf "body=%-7s shell=%-9s timeout\n" "$1" "$2"
+        return
+    fi
+    awk -v b="$1" -v s="$2" -v w="$best" -v mb="$MEGABYTES" 'BEGIN {
+        printf "body=%-7s shell=%-9s wall_ms=%-9s mb_per_s=%.1f\n",
+            b, s, w, mb / (w / 1000) }'
+}
+
+echo "=================================="
+echo "Minishell heredoc throughput"
+echo "=================================="
+echo "Body: $MEGABYTES MB, best of $RUNS, baselines: $SHELLS"
+echo ""
+
+for body in plain quoted expand; do
+    echo -e "${BLUE}$body${NC}"
+    run_one "$body" minishell "$MINISHELL"
+    for sh in $SHELLS; do
+        if command -v "$sh" > /dev/null; then
+            run_one "$body" "$sh" "$sh"
+        fi
+    done
+done
+echo -e "${GREEN}Done${NC}"
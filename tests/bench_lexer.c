@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_lexer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Lexer throughput driver for tests/bench_lexer.sh. Loads a file and
+** tokenizes it repeatedly through the per-line arena, either as one
+** command line or line by line like a script.
+**
+** Usage: bench_lexer <file> <line|script> <runs>
+*/
+
+#include "minishell.h"
+#include "libft.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+static char	*load_file(char *path, long *size)
+{
+	struct stat	st;
+	char		*data;
+	ssize_t		n;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0)
+		return (NULL);
+	data = malloc(st.st_size + 1);
+	*size = 0;
+	while (data && *size < st.st_size)
+	{
+		n = read(fd, data + *size, st.st_size - *size);
+		if (n <= 0)
+			break ;
+		*size += n;
+	}
+	close(fd);
+	if (data)
+		data[*size] = '\0';
+	return (data);
+}
+
+/*
+** In script mode each newline becomes a terminator, so the buffer holds
+** one NUL-separated line after another. Returns the number of lines.
+*/
+static long	split_lines(char *data, long size, int script)
+{
+	long	i;
+	long	lines;
+
+	lines = 1;
+	i = 0;
+	while (script && i < size)
+	{
+		if (data[i] == '\n')
+		{
+			data[i] = '\0';
+			lines++;
+		}
+		i++;
+	}
+	return (lines);
+}
+
+static long	run_once(char *data, long size, long lines, t_arena *arena)
+{
+	t_token	*tok;
+	long	tokens;
+	char	*line;
+
+	tokens = 0;
+	line = data;
+	while (lines-- > 0 && line <= data + size)
+	{
+		tok = tokenize(line, arena);
+		while (tok)
+		{
+			tokens++;
+			tok = tok->next;
+		}
+		arena_reset(arena);
+		line += ft_strlen(line) + 1;
+	}
+	return (tokens);
+}
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+int	main(int argc, char **argv)
+{
+	t_arena	arena;
+	char	*data;
+	long	size;
+	long	st[3];
+	double	t[2];
+
+	if (argc != 4)
+		return (fprintf(stderr, "usage: %s file line|script runs\n",
+				argv[0]), 2);
+	data = load_file(argv[1], &size);
+	if (!data)
+		return (perror(argv[1]), 1);
+	st[0] = split_lines(data, size, strcmp(argv[2], "script") == 0);
+	arena_init(&arena);
+	st[1] = run_once(data, size, st[0], &arena);
+	st[2] = atoi(argv[3]);
+	t[0] = now_ns();
+	while (argc++ < 4 + st[2])
+		run_once(data, size, st[0], &arena);
+	t[1] = (now_ns() - t[0]) / st[2];
+	printf("bytes=%ld lines=%ld tokens=%ld ns_per_byte=%.3f mb_per_s=%.1f\n",
+		size, st[0], st[1], t[1] / size, size / (t[1] / 1e9) / 1e6);
+	arena_free(&arena);
+	free(data);
+	return (0);
+}
@@ -0,0 +1,99 @@
+#!/bin/bash
+
+# Lexer throughput benchmark
+# Builds tests/bench_lexer.c against the project's object files and
+# tokenizes three generated inputs: a single command line of about one
+# megabyte, a long script tokenized line by line, and an xargs-style
+# line of long paths and quoted strings. Nothing is parsed or executed;
+# only tokenize() and the per-line arena are timed.
+#
+# The span scanners (src/lexer/scan_*.c) are recompiled once per width:
+# scalar, sse2, and avx2 when the CPU has it.
+#
+# Usage: tests/bench_lexer.sh [megabytes] [runs]
+#   megabytes  size of each generated input (default 1)
+#   runs       timed passes over each input (default 20)
+#
+# REPO can be set to benchmark the objects of another checkout, and
+# BENCH_CFLAGS to compile the scanners differently from the Makefile.
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+REPO="${REPO:-$SCRIPT_DIR/..}"
+MEGABYTES=${1:-1}
+RUNS=${2:-20}
+WORKDIR=$(mktemp -d)
+BENCH_CFLAGS=${BENCH_CFLAGS:-"-Wall -Wextra -Werror -O2"}
+
+if [ ! -f "$REPO/minishell" ]; then
+    echo -e "${RED}Error: minishell not built in $REPO. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+OBJS=$(ls "$REPO"/src/*/*.o "$REPO"/src/*.o | grep -v '/main\.o$\|/scan_')
+SCANS=$(ls "$REPO"/src/lexer/scan_*.c 2>/dev/null)
+
+# build_variant NAME CFLAGS...: the benchmark with the scanners rebuilt
+build_variant() {
+    local name=$1
+    shift
+    cc $BENCH_CFLAGS "$@" -I "$REPO/includes" -I "$REPO/libft" \
+        -o "$WORKDIR/bench_$name" "$SCRIPT_DIR/bench_lexer.c" $SCANS \
+        $OBJS "$REPO/libft/libft.a" -lreadline 2>/dev/null
+}
+
+VARIANTS=""
+build_variant scalar -D LEXER_SIMD=0 && VARIANTS="scalar"
+if grep -q sse2 /proc/cpuinfo 2>/dev/null && build_variant sse2; then
+    VARIANTS="$VARIANTS sse2"
+fi
+if grep -q avx2 /proc/cpuinfo 2>/dev/null && build_variant avx2 -mavx2; then
+    VARIANTS="$VARIANTS avx2"
+fi
+if [ -z "$VARIANTS" ]; then
+    echo -e "${RED}Error: could not build the lexer benchmark${NC}"
+    exit 1
+fi
+
+# One typical line: long and short words, both quote kinds, expansions,
+# redirections and every operator
+LINE='grep -rn --include=*.c "pattern $USER" src/lexer'\'' a b'\'' | sort -u'
+LINE="$LINE > out.txt && (cat < in.txt >> log) || echo fail"
+
+# Repeat LINE until the output reaches the requested size, joined by SEP
+generate() {
+    awk -v line="$LINE" -v sep="$1" -v bytes=$((MEGABYTES * 1048576)) \
+        'BEGIN { n = 0; while (n < bytes) { printf "%s%s", line, sep;
+                 n += length(line) + 1 } printf "\n" }'
+}
+
+generate " " > "$WORKDIR/line.txt"
+generate $'\n' > "$WORKDIR/script.txt"
+LINE="/usr/local/share/project/generated/sources/module_0042/component.c"
+LINE="$LINE \"a double-quoted argument with \$HOME and several words in it\""
+generate " " > "$WORKDIR/long.txt"
+
+echo "=================================="
+echo "Minishell lexer benchmark"
+echo "=================================="
+echo "Input size: ${MEGABYTES} MB, runs: $RUNS"
+echo ""
+
+for variant in $VARIANTS; do
+    echo -e "${BLUE}$variant single line:${NC}" \
+        "$("$WORKDIR/bench_$variant" "$WORKDIR/line.txt" line "$RUNS")"
+    echo -e "${BLUE}$variant script:${NC}" \
+        "$("$WORKDIR/bench_$variant" "$WORKDIR/script.txt" script "$RUNS")"
+    echo -e "${BLUE}$variant long words:${NC}" \
+        "$("$WORKDIR/bench_$variant" "$WORKDIR/long.txt" line "$RUNS")"
+done
+echo -e "${GREEN}Done${NC}"
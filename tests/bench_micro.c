@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Microbenchmarks for the line-processing phases, built by 'make bench'.
+** Each operation runs over every corpus input and prints one line:
+**
+**   op=<name> case=<name> iters=<n> ns_per_op=<f> allocs_per_op=<f>
+**   bytes_per_op=<f>
+**
+** Heap calls are counted by tests/alloc_count.c, linked in directly;
+** without glibc the two counts print as n/a.
+** An optional argument restricts the run to the operation of that name.
+*/
+
+#include "bench_micro.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+extern char	**environ;
+
+static double	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/*
+** One timed iteration; totals are {ns, allocs, bytes}.
+*/
+static void	bench_once(const t_bench_op *op, t_bench *b, double *totals)
+{
+	unsigned long	heap[4];
+	double			start;
+
+	if (op->setup)
+		op->setup(b);
+	alloc_count_read(&heap[0], &heap[1]);
+	start = now_ns();
+	op->run(b);
+	totals[0] += now_ns() - start;
+	alloc_count_read(&heap[2], &heap[3]);
+	totals[1] += heap[2] - heap[0];
+	totals[2] += heap[3] - heap[1];
+	if (op->teardown)
+		op->teardown(b);
+}
+
+/*
+** Iterate until the pair has had BENCH_MIN_NS of wall time, setup and
+** teardown included, so slow setups do not stretch the run.
+*/
+static void	bench_case(const t_bench_op *op, t_bench *b, const char *name)
+{
+	double			totals[3];
+	double			start;
+	long			iters;
+	unsigned long	heap[2];
+
+	bench_once(op, b, (double [3]){0, 0, 0});
+	totals[0] = 0;
+	totals[1] = 0;
+	totals[2] = 0;
+	iters = 0;
+	start = now_ns();
+	while (iters < BENCH_MAX_ITERS
+		&& (iters < BENCH_MIN_ITERS || now_ns() - start < BENCH_MIN_NS))
+	{
+		bench_once(op, b, totals);
+		iters++;
+	}
+	if (!alloc_count_read(&heap[0], &heap[1]))
+		printf("op=%s case=%s iters=%ld ns_per_op=%.1f allocs_per_op=n/a "
+			"bytes_per_op=n/a\n", op->name, name, iters, totals[0] / iters);
+	else
+		printf("op=%s case=%s iters=%ld ns_per_op=%.1f allocs_per_op=%.2f "
+			"bytes_per_op=%.1f\n", op->name, name, iters, totals[0] / iters,
+			totals[1] / iters, totals[2] / iters);
+	fflush(stdout);
+}
+
+/*
+** Every operation over every input of its kind, or only the operation
+** named on the command line.
+*/
+static void	run_ops(t_bench *b, t_bench_case *corpus, char *only)
+{
+	const t_bench_op	*op;
+	int					i;
+
+	op = bench_ops() - 1;
+	while ((++op)->name)
+	{
+		if (only && strcmp(only, op->name) != 0)
+			continue ;
+		i = -1;
+		while (corpus[++i].name)
+		{
+			b->input = corpus[i].input;
+			if (corpus[i].kind == op->kind)
+				bench_case(op, b, corpus[i].name);
+		}
+	}
+}
+
+int	main(int argc, char **argv)
+{
+	t_bench_case	*corpus;
+	t_bench			b;
+	char			dir[32];
+
+	b.ctx = init_exec_ctx(environ);
+	corpus = bench_corpus();
+	memcpy(dir, "/tmp/minishell_bench.XXXXXX", 28);
+	if (!b.ctx || !corpus || !mkdtemp(dir) || bench_glob_dir(dir, 1) < 0)
+		return (perror("bench_micro"), 1);
+	arena_init(&b.arena);
+	b.env_vars = 0;
+	b.out = NULL;
+	if (argc > 1)
+		run_ops(&b, corpus, argv[1]);
+	else
+		run_ops(&b, corpus, NULL);
+	bench_glob_dir(dir, 0);
+	arena_free(&b.arena);
+	bench_corpus_free(corpus);
+	cleanup_exec_ctx(b.ctx);
+	return (0);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_MICRO_H
+# define BENCH_MICRO_H
+
+# include "minishell.h"
+# include "expander.h"
+
+/*
+** Wall time spent on each (operation, input) pair, and the iteration
+** bounds around it.
+*/
+# define BENCH_MIN_NS 50000000.0
+# define BENCH_MIN_ITERS 10
+# define BENCH_MAX_ITERS 1000000
+
+/*
+** Files created in the scratch directory for the glob inputs
+*/
+# define BENCH_GLOB_FILES 2000
+
+/*
+** Line operations run over the command-line inputs, env operations over
+** environment sizes (the input holds the number of extra variables).
+*/
+# define BENCH_LINE 0
+# define BENCH_ENV 1
+
+/*
+** State shared by an operation's setup, run and teardown. Only run() is
+** timed and only its heap calls are counted.
+*/
+typedef struct s_bench
+{
+	t_exec_ctx	*ctx;
+	t_arena		arena;
+	char		*input;
+	t_token		*tokens;
+	char		**argv;
+	char		**out;
+	int			env_vars;
+}	t_bench;
+
+typedef struct s_bench_op
+{
+	const char	*name;
+	int			kind;
+	void		(*setup)(t_bench *b);
+	void		(*run)(t_bench *b);
+	void		(*teardown)(t_bench *b);
+}	t_bench_op;
+
+typedef struct s_bench_case
+{
+	const char	*name;
+	int			kind;
+	char		*input;
+}	t_bench_case;
+
+void				setup_tokens(t_bench *b);
+void				setup_expanded(t_bench *b);
+void				setup_argv(t_bench *b);
+void				setup_env(t_bench *b);
+void				bench_teardown(t_bench *b);
+void				run_tokenize(t_bench *b);
+void				run_validate(t_bench *b);
+void				run_parse(t_bench *b);
+void				run_expand(t_bench *b);
+void				run_glob(t_bench *b);
+/*
+** A generated input: head, then unit repeated count times, then mid,
+** then tail repeated count times.
+*/
+typedef struct s_bench_gen
+{
+	const char	*name;
+	int			kind;
+	const char	*head;
+	const char	*unit;
+	int			count;
+	const char	*mid;
+	const char	*tail;
+}	t_bench_gen;
+
+const t_bench_op	*bench_ops(void);
+t_bench_case		*bench_corpus(void);
+void				bench_corpus_free(t_bench_case *corpus);
+int					bench_glob_dir(char *dir, int create);
+int					alloc_count_read(unsigned long *allocs,
+						unsigned long *bytes);
+
+#endif
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro_corpus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_micro.h"
+
+/*
+** Realistic lines first, then adversarial ones: very long argument
+** lists, dense expansions and quoting, deep pipelines, long and/or
+** chains, nested subshells and globs over a large directory.
+*/
+static const t_bench_gen	*corpus_gens(void)
+{
+	static const t_bench_gen	gens[] = {
+	{"simple", BENCH_LINE, "ls -la /tmp", "", 0, "", ""},
+	{"typical", BENCH_LINE, "echo \"hello $USER\" 'world' | grep -v foo"
+		" > /dev/null && cat < /etc/hostname || echo fail", "", 0, "", ""},
+	{"args_2000", BENCH_LINE, "echo", " argument_word", 2000, "", ""},
+	{"vars_500", BENCH_LINE, "echo", " $HOME \"$USER:$PATH\"", 500, "", ""},
+	{"quotes_500", BENCH_LINE, "echo", " 'single' \"double\"", 500, "", ""},
+	{"pipeline_200", BENCH_LINE, "cat /dev/null", " | cat", 200, "", ""},
+	{"logical_500", BENCH_LINE, "true", " && true || false", 500, "", ""},
+	{"subshell_100", BENCH_LINE, "", "(true && ", 100, "true", ")"},
+	{"glob_match", BENCH_LINE, "echo * *.txt data_0*.log file_?????.txt"
+		" [a-e]*", "", 0, "", ""},
+	{"glob_miss", BENCH_LINE, "echo *zz* *q*q*q* [xyz]*", "", 0, "", ""},
+	{"env_default", BENCH_ENV, "0", "", 0, "", ""},
+	{"env_1000", BENCH_ENV, "1000", "", 0, "", ""},
+	{NULL, 0, NULL, NULL, 0, NULL, NULL}};
+
+	return (gens);
+}
+
+static char	*generate(const t_bench_gen *gen)
+{
+	t_strbuf	sb;
+	char		*line;
+	int			i;
+	int			ok;
+
+	sb_init(&sb);
+	ok = sb_append_str(&sb, gen->head);
+	i = 0;
+	while (ok && i++ < gen->count)
+		ok = sb_append_str(&sb, gen->unit);
+	ok = ok && sb_append_str(&sb, gen->mid);
+	i = 0;
+	while (ok && i++ < gen->count)
+		ok = sb_append_str(&sb, gen->tail);
+	line = NULL;
+	if (ok)
+		line = sb_dup(&sb);
+	sb_free(&sb);
+	return (line);
+}
+
+void	bench_corpus_free(t_bench_case *corpus)
+{
+	int	i;
+
+	i = 0;
+	while (corpus && corpus[i].name)
+		free(corpus[i++].input);
+	free(corpus);
+}
+
+t_bench_case	*bench_corpus(void)
+{
+	const t_bench_gen	*gens;
+	t_bench_case		*corpus;
+	int					n;
+
+	gens = corpus_gens();
+	n = 0;
+	while (gens[n].name)
+		n++;
+	corpus = calloc(n + 1, sizeof(t_bench_case));
+	n = -1;
+	while (corpus && gens[++n].name)
+	{
+		corpus[n].name = gens[n].name;
+		corpus[n].kind = gens[n].kind;
+		corpus[n].input = generate(&gens[n]);
+		if (!corpus[n].input)
+		{
+			bench_corpus_free(corpus);
+			return (NULL);
+		}
+	}
+	return (corpus);
+}
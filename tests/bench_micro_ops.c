@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro_ops.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_micro.h"
+#include <fcntl.h>
+#include <stdio.h>
+
+static void	run_envp(t_bench *b)
+{
+	b->out = env_to_envp(b->ctx->env);
+}
+
+/*
+** The benchmarked phases in process_line order, then env_to_envp,
+** which every external command pays for when the environment changed.
+*/
+const t_bench_op	*bench_ops(void)
+{
+	static const t_bench_op	ops[] = {
+	{"tokenize", BENCH_LINE, NULL, run_tokenize, bench_teardown},
+	{"validate_syntax", BENCH_LINE, setup_tokens, run_validate,
+		bench_teardown},
+	{"expand_tokens", BENCH_LINE, setup_tokens, run_expand, bench_teardown},
+	{"parse_tokens", BENCH_LINE, setup_expanded, run_parse, bench_teardown},
+	{"expand_argv_wildcards", BENCH_LINE, setup_argv, run_glob,
+		bench_teardown},
+	{"env_to_envp", BENCH_ENV, setup_env, run_envp, bench_teardown},
+	{NULL, 0, NULL, NULL, NULL}};
+
+	return (ops);
+}
+
+/*
+** Fill dir with BENCH_GLOB_FILES entries and make it the working
+** directory for the glob inputs, or (create == 0) remove them again.
+*/
+int	bench_glob_dir(char *dir, int create)
+{
+	char	name[64];
+	int		i;
+	int		fd;
+
+	if (create && chdir(dir) < 0)
+		return (-1);
+	i = 0;
+	while (i < BENCH_GLOB_FILES)
+	{
+		if (i % 2)
+			snprintf(name, sizeof(name), "file_%05d.txt", i++);
+		else
+			snprintf(name, sizeof(name), "data_%05d.log", i++);
+		fd = -1;
+		if (create)
+			fd = open(name, O_CREAT | O_WRONLY, 0644);
+		else
+			unlink(name);
+		if (fd >= 0)
+			close(fd);
+	}
+	if (!create && chdir("/") == 0)
+		rmdir(dir);
+	return (0);
+}
@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro_run.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_micro.h"
+
+void	run_tokenize(t_bench *b)
+{
+	b->tokens = tokenize(b->input, &b->arena);
+}
+
+void	run_validate(t_bench *b)
+{
+	validate_syntax(b->tokens);
+}
+
+void	run_parse(t_bench *b)
+{
+	parse_tokens(b->tokens, &b->arena);
+}
+
+void	run_expand(t_bench *b)
+{
+	expand_tokens(b->tokens, b->ctx, &b->arena);
+}
+
+void	run_glob(t_bench *b)
+{
+	b->out = expand_argv_wildcards(b->argv);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_micro_setup.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_micro.h"
+#include "libft.h"
+#include <stdio.h>
+
+/*
+** Setups bring the input to the state the timed phase sees inside
+** process_line: tokenized, then expanded, then parsed. Expansion
+** terminates words in place, so it always works on an arena copy.
+*/
+void	setup_tokens(t_bench *b)
+{
+	char	*line;
+
+	line = arena_strndup(&b->arena, b->input, ft_strlen(b->input));
+	b->tokens = tokenize(line, &b->arena);
+}
+
+void	setup_expanded(t_bench *b)
+{
+	setup_tokens(b);
+	expand_tokens(b->tokens, b->ctx, &b->arena);
+}
+
+/*
+** The argv of a simple command: the expanded words before the first
+** operator.
+*/
+void	setup_argv(t_bench *b)
+{
+	t_token	*tok;
+	int		count;
+
+	setup_expanded(b);
+	count = 0;
+	tok = b->tokens;
+	while (tok && tok->type == TOKEN_WORD && ++count)
+		tok = tok->next;
+	b->argv = arena_alloc(&b->arena, (count + 1) * sizeof(char *));
+	count = 0;
+	tok = b->tokens;
+	while (tok && tok->type == TOKEN_WORD)
+	{
+		b->argv[count++] = token_value(tok, &b->arena);
+		tok = tok->next;
+	}
+	b->argv[count] = NULL;
+}
+
+/*
+** Grow the environment to the case's size before env_to_envp runs;
+** sizes only increase, so this does nothing after the first iteration.
+*/
+void	setup_env(t_bench *b)
+{
+	char	name[32];
+	int		target;
+
+	target = atoi(b->input);
+	while (b->env_vars < target)
+	{
+		snprintf(name, sizeof(name), "BENCH_VAR_%d", b->env_vars++);
+		env_set(&b->ctx->env, name, "a moderately long value /usr/bin");
+	}
+}
+
+void	bench_teardown(t_bench *b)
+{
+	if (b->out)
+		free_argv(b->out);
+	b->out = NULL;
+	arena_reset(&b->arena);
+}
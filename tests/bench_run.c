@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: tkeereweer <tkeereweer@student.42.fr>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:00:00 by tkeereweer       #+#    #+#             */
+/*   Updated: 2026/10/17 09:00:00 by tkeereweer      ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Process-cost probe for tests/bench_e2e.sh. Runs a shell with a
+** workload file on stdin and prints, for the shell and everything it
+** waited for:
+**
+**   wall_ms=<f> user_ms=<f> sys_ms=<f> maxrss_kb=<n> pids=<n> status=<n>
+**
+** pids is the number of process IDs the system handed out meanwhile,
+** taken from /proc/loadavg; it counts forks exactly on an otherwise idle
+** machine and is -1 where that file does not exist.
+**
+** The shell runs in its own process group, which is killed after
+** BENCH_TIMEOUT seconds (default 60); the line then ends in timeout=1.
+**
+** Usage: bench_run <workload> <shell> [args...]
+*/
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static pid_t	g_child;
+
+static void	on_alarm(int sig)
+{
+	(void)sig;
+	kill(-g_child, SIGKILL);
+}
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e3 + ts.tv_nsec / 1e6);
+}
+
+static long	last_pid(void)
+{
+	FILE	*f;
+	long	pid;
+
+	f = fopen("/proc/loadavg", "r");
+	if (!f)
+		return (-1);
+	if (fscanf(f, "%*s %*s %*s %*s %ld", &pid) != 1)
+		pid = -1;
+	fclose(f);
+	return (pid);
+}
+
+/*
+** PIDs handed out between two readings, not counting the shell itself;
+** allows for one wrap past /proc/sys/kernel/pid_max.
+*/
+static long	pid_delta(long before, long after)
+{
+	FILE	*f;
+	long	max;
+
+	if (after < 0)
+		return (-1);
+	if (after <= before)
+	{
+		f = fopen("/proc/sys/kernel/pid_max", "r");
+		if (!f || fscanf(f, "%ld", &max) != 1)
+			max = 32768;
+		if (f)
+			fclose(f);
+		after += max;
+	}
+	return (after - before - 1);
+}
+
+static pid_t	start_shell(char *workload, char **argv)
+{
+	pid_t	pid;
+	int		fd;
+
+	fd = open(workload, O_RDONLY);
+	if (fd < 0)
+		return (perror(workload), -1);
+	pid = fork();
+	if (pid == 0)
+	{
+		setpgid(0, 0);
+		dup2(fd, STDIN_FILENO);
+		close(fd);
+		execvp(argv[0], argv);
+		perror(argv[0]);
+		_exit(127);
+	}
+	close(fd);
+	if (pid > 0)
+		setpgid(pid, pid);
+	return (pid);
+}
+
+static double	tv_ms(struct timeval tv)
+{
+	return (tv.tv_sec * 1e3 + tv.tv_usec / 1e3);
+}
+
+int	main(int argc, char **argv)
+{
+	struct rusage	ru;
+	double			start;
+	long			pids;
+	int				status;
+	pid_t			pid;
+
+	if (argc < 3)
+		return (fprintf(stderr, "usage: %s workload shell [args...]\n",
+				argv[0]), 2);
+	pids = last_pid();
+	start = now_ms();
+	pid = start_shell(argv[1], argv + 2);
+	g_child = pid;
+	signal(SIGALRM, on_alarm);
+	if (getenv("BENCH_TIMEOUT"))
+		alarm(atoi(getenv("BENCH_TIMEOUT")));
+	else
+		alarm(60);
+	if (pid < 0 || wait4(pid, &status, 0, &ru) < 0)
+		return (1);
+	start = now_ms() - start;
+	if (pids >= 0)
+		pids = pid_delta(pids, last_pid());
+	printf("wall_ms=%.1f user_ms=%.1f sys_ms=%.1f maxrss_kb=%ld pids=%ld "
+		"status=%d timeout=%d\n", start, tv_ms(ru.ru_utime),
+		tv_ms(ru.ru_stime), ru.ru_maxrss, pids, WEXITSTATUS(status),
+		WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL);
+	return (0);
+}
@@ -0,0 +1,85 @@
+#!/bin/bash
+
+# Spawn vs fork benchmark
+# Runs the same batch of external commands through minishell twice:
+# once with the posix_spawn fast path and once with MINISHELL_NO_SPAWN=1
+# (plain fork + execve). Reports the average latency per command.
+#
+# Usage: tests/bench_spawn.sh [commands] [env_vars]
+#   commands  number of external commands to run (default 2000)
+#   env_vars  extra variables exported first to grow the shell heap
+#             (default 2000)
+
+GREEN='\033[0;32m'
+RED='\033[0;31m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+MINISHELL="$SCRIPT_DIR/../minishell"
+COMMANDS=${1:-2000}
+ENV_VARS=${2:-2000}
+WORKLOAD=$(mktemp)
+
+if [ ! -f "$MINISHELL" ]; then
+    echo -e "${RED}Error: minishell not found. Run 'make' first.${NC}"
+    exit 1
+fi
+
+cleanup() {
+    rm -f "$WORKLOAD"
+}
+trap cleanup EXIT
+
+# Build the workload: a block of exports to inflate the heap, then the
+# timed commands. Both runs execute exactly the same input.
+build_workload() {
+    local pad
+    pad=$(printf '%*s' 200 '' | tr ' ' 'x')
+    for ((i = 0; i < ENV_VARS; i++)); do
+        echo "export BENCH_VAR_$i=$pad"
+    done
+    for ((i = 0; i < COMMANDS; i++)); do
+        echo "/bin/true"
+    done
+}
+
+# Run the workload and print elapsed nanoseconds
+run_workload() {
+    local start end
+    start=$(date +%s%N)
+    env "$@" "$MINISHELL" < "$WORKLOAD" > /dev/null 2>&1
+    end=$(date +%s%N)
+    echo $((end - start))
+}
+
+# Elapsed time of the export block alone, subtracted from both runs
+run_baseline() {
+    local start end
+    head -n "$ENV_VARS" "$WORKLOAD" > "$WORKLOAD.base"
+    start=$(date +%s%N)
+    "$MINISHELL" < "$WORKLOAD.base" > /dev/null 2>&1
+    end=$(date +%s%N)
+    rm -f "$WORKLOAD.base"
+    echo $((end - start))
+}
+
+echo "=================================="
+echo "Minishell spawn benchmark"
+echo "=================================="
+echo "Commands: $COMMANDS, extra env vars: $ENV_VARS"
+echo ""
+
+build_workload > "$WORKLOAD"
+base_ns=$(run_baseline)
+spawn_ns=$(run_workload)
+fork_ns=$(run_workload MINISHELL_NO_SPAWN=1)
+
+spawn_us=$(( (spawn_ns - base_ns) / COMMANDS / 1000 ))
+fork_us=$(( (fork_ns - base_ns) / COMMANDS / 1000 ))
+
+echo -e "${BLUE}posix_spawn:${NC} ${spawn_us} us/command"
+echo -e "${BLUE}fork+execve:${NC} ${fork_us} us/command"
+if [ "$spawn_us" -gt 0 ]; then
+    echo -e "${GREEN}fork/spawn latency ratio: $(( fork_us * 100 / spawn_us ))%${NC}"
+fi
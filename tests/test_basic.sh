@@ -59,3 +59,50 @@ run_test "empty_command" \
 run_test "whitespace_only" \
     "   " \
     "Whitespace only"
+
+run_test "hash_empty" \
+    "hash" \
+    "Empty command hash table"
+
+run_test "hash_after_exec" \
+    "cat testfile && cat testfile && hash" \
+    "Hash table records hits after execution"
+
+run_test "hash_prefill" \
+    "hash cat && hash" \
+    "Prefill hash table without executing"
+
+run_test "hash_reset" \
+    "cat testfile && hash -r && hash" \
+    "Clear hash table with -r"
+
+run_test "hash_not_found" \
+    "hash nonexistent_cmd_xyz" \
+    "Hash unknown command"
+
+run_test "hash_path_reset" \
+    "cat testfile && export PATH=/bin && hash" \
+    "Hash table cleared when PATH changes"
+
+run_test "multiple_lines" \
+    "echo one
+echo two
+pwd" \
+    "Several lines of piped input run in order"
+
+run_test "status_at_eof" \
+    "false" \
+    "Shell exits with the last status at end of input"
+
+run_test "builtin_redirect_flush" \
+    "echo first > out_flush
+cat out_flush" \
+    "Builtin output reaches its redirect before restore"
+
+run_shell_test "stdin_shared_pipe" \
+    "printf 'cat\nhello\necho after\n' | \"\$TEST_SHELL\"" \
+    "Piped input after a line is left for the command it runs"
+
+run_shell_test "stdin_shared_file" \
+    "printf 'head -n 1\nfirst\necho after\n' > in_shared && \"\$TEST_SHELL\" < in_shared" \
+    "Redirected script input is rewound past the current line"
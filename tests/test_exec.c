@@ -33,23 +33,21 @@ void	test_echo(t_exec_ctx *ctx)
 	int			status;
 
 	printf("\n=== Testing echo built-in ===\n");
-	tokens = tokenize("echo hello world");
-	ast = parse_tokens(tokens);
+	tokens = tokenize("echo hello world", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("Expected: hello world\n");
 	printf("Got:      ");
 	status = execute_ast(ast, ctx);
 	print_status("echo hello world", status);
-	free_ast(ast);
-	free_tokens(tokens);
-	tokens = tokenize("echo -n test");
-	ast = parse_tokens(tokens);
+	arena_reset(&ctx->line_arena);
+	tokens = tokenize("echo -n test", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("\nExpected: test (no newline)\n");
 	printf("Got:      ");
 	status = execute_ast(ast, ctx);
 	printf("\n");
 	print_status("echo -n test", status);
-	free_ast(ast);
-	free_tokens(tokens);
+	arena_reset(&ctx->line_arena);
 }
 
 void	test_pwd(t_exec_ctx *ctx)
@@ -59,13 +57,12 @@ void	test_pwd(t_exec_ctx *ctx)
 	int			status;
 
 	printf("\n=== Testing pwd built-in ===\n");
-	tokens = tokenize("pwd");
-	ast = parse_tokens(tokens);
+	tokens = tokenize("pwd", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("Current directory:\n");
 	status = execute_ast(ast, ctx);
 	print_status("pwd", status);
-	free_ast(ast);
-	free_tokens(tokens);
+	arena_reset(&ctx->line_arena);
 }
 
 void	test_env(t_exec_ctx *ctx)
@@ -75,12 +72,11 @@ void	test_env(t_exec_ctx *ctx)
 	int			status;
 
 	printf("\n=== Testing env built-in (first 5 vars) ===\n");
-	tokens = tokenize("env");
-	ast = parse_tokens(tokens);
+	tokens = tokenize("env", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	status = execute_ast(ast, ctx);
 	print_status("env", status);
-	free_ast(ast);
-	free_tokens(tokens);
+	arena_reset(&ctx->line_arena);
 }
 
 void	test_external_commands(t_exec_ctx *ctx)
@@ -90,21 +86,19 @@ void	test_external_commands(t_exec_ctx *ctx)
 	int			status;
 
 	printf("\n=== Testing external commands ===\n");
-	tokens = tokenize("/bin/echo external command test");
-	ast = parse_tokens(tokens);
+	tokens = tokenize("/bin/echo external command test", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("Expected: external command test\n");
 	printf("Got:      ");
 	status = execute_ast(ast, ctx);
 	print_status("/bin/echo", status);
-	free_ast(ast);
-	free_tokens(tokens);
-	tokens = tokenize("ls -la");
-	ast = parse_tokens(tokens);
+	arena_reset(&ctx->line_arena);
+	tokens = tokenize("ls -la", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("\nListing directory:\n");
 	status = execute_ast(ast, ctx);
 	print_status("ls -la (PATH resolution)", status);
-	free_ast(ast);
-	free_tokens(tokens);
+	arena_reset(&ctx->line_arena);
 }
 
 void	test_logical_operators(t_exec_ctx *ctx)
@@ -114,22 +108,20 @@ void	test_logical_operators(t_exec_ctx *ctx)
 	int			status;
 
 	printf("\n=== Testing logical operators ===\n");
-	tokens = tokenize("echo first && echo second");
-	ast = parse_tokens(tokens);
+	tokens = tokenize("echo first && echo second", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("Expected: first\\nsecond\n");
 	printf("Got:\n");
 	status = execute_ast(ast, ctx);
 	print_status("echo first && echo second", status);
-	free_ast(ast);
-	free_tokens(tokens);
-	tokens = tokenize("/bin/false || echo fallback");
-	ast = parse_tokens(tokens);
+	arena_reset(&ctx->line_arena);
+	tokens = tokenize("/bin/false || echo fallback", &ctx->line_arena);
+	ast = parse_tokens(tokens, &ctx->line_arena);
 	printf("\nExpected: fallback\n");
 	printf("Got:\n");
 	status = execute_ast(ast, ctx);
 	print_status("/bin/false || echo fallback", status);
-	free_ast(ast);
-	free_tokens(tokens);
+	arena_reset(&ctx->line_arena);
 }
 
 int	main(void)
@@ -77,3 +77,31 @@ run_test "exit_wildcard_status" \
 run_test "exit_sequence" \
     "true; false; true; echo \$?" \
     "Exit status of last command in sequence"
+
+run_shell_test "c_status" \
+    "\"\$TEST_SHELL\" -c 'ls nonexistent_file'; echo \$?" \
+    "-c exits with the status of its line"
+
+run_shell_test "c_exit_builtin" \
+    "\"\$TEST_SHELL\" -c 'exit 7'; echo \$?" \
+    "exit N in -c sets the shell's status"
+
+run_shell_test "c_missing_argument" \
+    "\"\$TEST_SHELL\" -c; echo \$?" \
+    "-c without a command string fails with status 2"
+
+run_shell_test "c_syntax_error" \
+    "\"\$TEST_SHELL\" -c '| x'; echo \$?" \
+    "Syntax error in -c exits with status 2"
+
+run_shell_test "c_exec_tail_and" \
+    "\"\$TEST_SHELL\" -c '/bin/echo one && /bin/echo two'; echo \$?" \
+    "Command before && is not exec'd in place of the shell"
+
+run_shell_test "c_exec_tail_or" \
+    "\"\$TEST_SHELL\" -c '/bin/ls nonexistent_file || /bin/echo fallback'; echo \$?" \
+    "Command before || is not exec'd in place of the shell"
+
+run_shell_test "c_exec_tail_status" \
+    "\"\$TEST_SHELL\" -c 'true && /bin/ls nonexistent_file'; echo \$?" \
+    "Last command exec'd in place of the shell keeps its status"
@@ -77,3 +77,38 @@ run_test "heredoc_to_file" \
 content
 EOF" \
     "Heredoc redirected to file"
+
+run_test "heredoc_skipped_command" \
+    "false && cat << EOF
+skipped
+EOF
+echo after" \
+    "Heredoc of a command skipped by && is still consumed"
+
+run_test "heredoc_each_pipeline_stage" \
+    "cat << A | cat - << B
+first
+A
+second
+B" \
+    "Heredocs of several pipeline stages, read in order"
+
+run_test "heredoc_single_quoted_delimiter" \
+    "export VAR=value && cat << 'EOF'
+raw \$VAR \"\$VAR\" \$?
+EOF" \
+    "Quoted delimiter copies the body without expansion"
+
+run_test "heredoc_delimiter_not_expanded" \
+    "export VAR=value && cat << \$VAR
+\$VAR body
+\$VAR" \
+    "Variables in the delimiter are not expanded"
+
+# Larger than a pipe buffer (64 KiB): must not block before wc starts
+HEREDOC_LARGE_BODY=$(head -c 70000 /dev/zero | tr '\0' 'a' | fold -w 99)
+run_test "heredoc_larger_than_pipe" \
+    "wc -c << EOF
+$HEREDOC_LARGE_BODY
+EOF" \
+    "Heredoc body larger than a pipe buffer"
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+echo ""
+echo "=== Timing and Trace Tests ==="
+echo ""
+
+run_check "timing_c_exec_tail" \
+    "MINISHELL_TIMING=timing.log \"\$TEST_SHELL\" -c '/bin/echo hi' > /dev/null && grep -q '^timing line=1 ' timing.log" \
+    "-c with timing on still reports its line"
+
+run_check "trace_valid_json" \
+    "printf 'echo one\n%s -c \"echo nested\"\necho two | cat\n' \"\$TEST_SHELL\" | MINISHELL_TRACE=trace.json \"\$TEST_SHELL\" > /dev/null && python3 -m json.tool trace.json > /dev/null" \
+    "Trace file is valid JSON, with a nested minishell"
@@ -43,8 +43,9 @@ static char	*token_type_str(t_token_type type)
 
 static void	print_token(t_token *token)
 {
-	if (token->value)
-		printf("[%s: '%s']\n", token_type_str(token->type), token->value);
+	if (token->start)
+		printf("[%s: '%.*s']\n", token_type_str(token->type), token->len,
+			token->start);
 	else
 		printf("[%s]\n", token_type_str(token->type));
 }
@@ -63,13 +64,15 @@ static void	print_tokens(t_token *tokens)
 
 static void	test_case(char *input)
 {
+	t_arena	arena;
 	t_token	*tokens;
 
 	printf("\nTest: \"%s\"\n", input);
 	printf("Tokens:\n");
-	tokens = tokenize(input);
+	arena_init(&arena);
+	tokens = tokenize(input, &arena);
 	print_tokens(tokens);
-	token_list_free(tokens);
+	arena_free(&arena);
 }
 
 int	main(void)
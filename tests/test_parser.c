@@ -71,9 +71,7 @@ static void	print_binop_node(t_ast_node *node, int depth)
 {
 	char	*op;
 
-	if (node->type == NODE_PIPE)
-		op = "PIPE";
-	else if (node->type == NODE_AND)
+	if (node->type == NODE_AND)
 		op = "AND";
 	else
 		op = "OR";
@@ -83,6 +81,20 @@ static void	print_binop_node(t_ast_node *node, int depth)
 	print_ast_rec(node->data.binop.right, depth + 1);
 }
 
+static void	print_pipeline_node(t_ast_node *node, int depth)
+{
+	int	i;
+
+	print_indent(depth);
+	printf("PIPELINE (%d stages)\n", node->data.pipeline.count);
+	i = 0;
+	while (i < node->data.pipeline.count)
+	{
+		print_ast_rec(node->data.pipeline.stages[i], depth + 1);
+		i++;
+	}
+}
+
 static void	print_subshell_node(t_ast_node *node, int depth)
 {
 	print_indent(depth);
@@ -100,6 +112,8 @@ static void	print_ast_rec(t_ast_node *node, int depth)
 		print_cmd_node(node, depth);
 	else if (node->type == NODE_SUBSHELL)
 		print_subshell_node(node, depth);
+	else if (node->type == NODE_PIPE)
+		print_pipeline_node(node, depth);
 	else
 		print_binop_node(node, depth);
 }
@@ -112,26 +126,26 @@ static void	print_ast(t_ast_node *node)
 
 static void	test_case(char *input)
 {
+	t_arena		arena;
 	t_token		*tokens;
 	t_ast_node	*ast;
 
 	printf("\n========================================\n");
 	printf("Input: \"%s\"\n", input);
-	tokens = tokenize(input);
+	arena_init(&arena);
+	tokens = tokenize(input, &arena);
 	if (!tokens)
 	{
 		printf("Error: tokenization failed\n");
+		arena_free(&arena);
 		return ;
 	}
-	ast = parse_tokens(tokens);
+	ast = parse_tokens(tokens, &arena);
 	if (!ast)
 		printf("Error: parsing failed\n");
 	else
-	{
 		print_ast(ast);
-		free_ast(ast);
-	}
-	token_list_free(tokens);
+	arena_free(&arena);
 }
 
 int	main(void)
@@ -146,6 +160,7 @@ int	main(void)
 	test_case("cmd1 || cmd2");
 	test_case("cmd1 && cmd2 || cmd3");
 	test_case("cmd1 | cmd2 | cmd3");
+	test_case("a | b | c | d | e | f");
 	test_case("(echo test) | cat");
 	test_case("echo a | cat && ls");
 	return (0);
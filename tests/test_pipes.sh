@@ -59,3 +59,11 @@ run_test "pipe_to_head" \
 run_test "pipe_sort" \
     "printf 'c\na\nb' | sort" \
     "Pipe to sort"
+
+run_test "pipe_subshell_stage" \
+    "echo hello | (cat && echo done) | cat" \
+    "Subshell as a pipeline stage"
+
+run_test "pipe_stage_redirect" \
+    "echo hello | cat > pipe_out && cat pipe_out" \
+    "Last stage with its own redirection"
@@ -59,3 +59,34 @@ run_test "append_multiple" \
 run_test "redirect_nonexistent" \
     "cat < nonexistent.txt 2>&1" \
     "Redirect from nonexistent file"
+
+run_test "redirect_fail_restores_stdout" \
+    "echo hi > out_restore.txt < nonexistent_file || echo visible" \
+    "Failed redirect does not leave stdout redirected"
+
+run_test "subshell_redirect_fail" \
+    "(echo ran) < nonexistent_file || echo failed" \
+    "Subshell does not run when its redirect fails"
+
+run_test "external_redirect_in_fail" \
+    "cat < nonexistent_file
+echo \$?
+echo stdout intact" \
+    "Failed input redirect on an external command: status 1, stdout kept"
+
+run_test "external_redirect_out_fail" \
+    "ls > nonexistent_dir/out
+echo \$?
+echo stdout intact" \
+    "Failed output redirect on an external command: status 1, stdout kept"
+
+run_test "external_heredoc_and_out" \
+    "cat << EOF > out_heredoc.txt
+body \$HOME
+EOF
+cat out_heredoc.txt" \
+    "Heredoc and output redirect on one external command"
+
+run_shell_test "external_redirects_fork" \
+    "printf 'cat < file1 > out_fork.txt\ncat out_fork.txt\ncat < nonexistent_file\necho \$?\nls > nonexistent_dir/out\necho \$?\ncat << EOF > out_fork_hd.txt\nbody\nEOF\ncat out_fork_hd.txt\n' | MINISHELL_NO_SPAWN=1 \"\$TEST_SHELL\"" \
+    "Redirects of external commands on the fork path"
@@ -61,7 +61,52 @@ run_test() {
     # Run in minishell
     (cd "$SCRIPT_DIR/tmp" && echo "$test_cmd" | "$MINISHELL" > "$SCRIPT_DIR/results/minishell_out" 2> "$SCRIPT_DIR/results/minishell_err"; echo $? > "$SCRIPT_DIR/results/minishell_status")
 
-    # Compare outputs
+    compare_results
+}
+
+# Run a test as a bash command line in which $TEST_SHELL is the shell
+# under test: bash for the reference run, then minishell. For cases that
+# start the shell themselves (-c, piped input, environment switches).
+run_shell_test() {
+    local test_name="$1"
+    local test_cmd="$2"
+    local description="$3"
+
+    echo -e "${BLUE}Testing:${NC} $test_name"
+    echo -e "${YELLOW}Command:${NC} $test_cmd"
+    echo -e "${YELLOW}Description:${NC} $description"
+
+    (cd "$SCRIPT_DIR/tmp" && TEST_SHELL=bash bash -c "$test_cmd" > "$SCRIPT_DIR/results/bash_out" 2> "$SCRIPT_DIR/results/bash_err"; echo $? > "$SCRIPT_DIR/results/bash_status")
+    (cd "$SCRIPT_DIR/tmp" && TEST_SHELL="$MINISHELL" bash -c "$test_cmd" > "$SCRIPT_DIR/results/minishell_out" 2> "$SCRIPT_DIR/results/minishell_err"; echo $? > "$SCRIPT_DIR/results/minishell_status")
+
+    compare_results
+}
+
+# Run a bash command line with $TEST_SHELL set to minishell; it passes
+# when it exits 0. For minishell-only features (timing, tracing) with
+# no bash output to compare against.
+run_check() {
+    local test_name="$1"
+    local test_cmd="$2"
+    local description="$3"
+
+    echo -e "${BLUE}Testing:${NC} $test_name"
+    echo -e "${YELLOW}Command:${NC} $test_cmd"
+    echo -e "${YELLOW}Description:${NC} $description"
+
+    if (cd "$SCRIPT_DIR/tmp" && TEST_SHELL="$MINISHELL" bash -c "$test_cmd" > "$SCRIPT_DIR/results/minishell_out" 2> "$SCRIPT_DIR/results/minishell_err"); then
+        echo -e "${GREEN}✓ PASSED${NC}\n"
+        ((PASSED++))
+    else
+        echo -e "${RED}✗ FAILED${NC}"
+        cat "$SCRIPT_DIR/results/minishell_out" "$SCRIPT_DIR/results/minishell_err"
+        echo ""
+        ((FAILED++))
+    fi
+}
+
+# Compare the last pair of runs and count the result
+compare_results() {
     bash_out=$(cat "$SCRIPT_DIR/results/bash_out")
     minishell_out=$(cat "$SCRIPT_DIR/results/minishell_out")
     bash_status=$(cat "$SCRIPT_DIR/results/bash_status")
@@ -125,6 +170,7 @@ source "$SCRIPT_DIR/test_pipes.sh"
 source "$SCRIPT_DIR/test_logical.sh"
 source "$SCRIPT_DIR/test_exit_status.sh"
 source "$SCRIPT_DIR/test_edge_cases.sh"
+source "$SCRIPT_DIR/test_instrumentation.sh"
 
 cleanup
 print_summary
@@ -59,3 +59,39 @@ run_test "wildcard_ls" \
 run_test "wildcard_cat" \
     "cat file*" \
     "Wildcard with cat command"
+
+run_test "wildcard_question" \
+    "echo file?" \
+    "Question mark matches one character"
+
+run_test "wildcard_bracket" \
+    "echo [ab].txt" \
+    "Bracket class"
+
+run_test "wildcard_bracket_range" \
+    "echo file[1-2]" \
+    "Bracket range"
+
+run_test "wildcard_bracket_negate" \
+    "echo [!a].txt" \
+    "Negated bracket class"
+
+run_test "wildcard_unclosed_bracket" \
+    "echo [abc" \
+    "Unclosed bracket stays literal"
+
+run_test "wildcard_question_dquoted" \
+    "echo \"file?\"" \
+    "Double-quoted question mark stays literal"
+
+run_test "wildcard_question_squoted" \
+    "echo 'file?'" \
+    "Single-quoted question mark stays literal"
+
+run_test "wildcard_bracket_quoted" \
+    "touch a && echo \"[a]\" '[a]'" \
+    "Quoted bracket class stays literal"
+
+run_test "wildcard_star_quoted" \
+    "echo \"*\"" \
+    "Quoted star stays literal"